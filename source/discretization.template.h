@@ -125,40 +125,14 @@ namespace ryujin
     if constexpr (have_distributed_triangulation<dim>) {
       if (mesh_repartitioning_) {
         /*
-         * Try to partition the mesh equilibrating the workload. The usual mesh
-         * partitioning heuristic that tries to partition the mesh such that
-         * every MPI rank has roughly the same number of locally owned degrees
-         * of freedom does not work well in our case due to the fact that
-         * boundary dofs are not SIMD parallelized. (In fact, every dof with
-         * "non-standard connectivity" is not SIMD parallelized. Those are
-         * however exceedingly rare (point irregularities in 2D, line
-         * irregularities in 3D) and we simply ignore them.)
-         *
-         * For the mesh partitioning scheme we have to supply an additional
-         * weight that gets added to the default weight of a cell which is
-         * 1000. Asymptotically we have one boundary dof per boundary cell (in
-         * any dimension). A rough benchmark reveals that the speedup due to
-         * SIMD vectorization is typically less than VectorizedArray::size() /
-         * 2. Boundary dofs are more expensive due to certain special treatment
-         * (additional symmetrization of d_ij, boundary fixup) so it should be
-         * safe to assume that the cost incurred is at least
-         * VectorizedArray::size() / 2.
+         * Repartition the mesh with the default (uniform) cell weights.
+         * We do not supply an additional weight for boundary cells:
+         * OfflineData::setup() groups all rows with identical stencil
+         * size (including boundary and constrained rows) into SIMD
+         * strides, so that only a small remainder of at most
+         * VectorizedArray::size() - 1 rows per stencil size is processed
+         * with the scalar code path.
          */
-        constexpr auto speedup = dealii::VectorizedArray<NUMBER>::size() / 2u;
-        constexpr unsigned int weight = 1000u;
-
-#if DEAL_II_VERSION_GTE(9, 5, 0)
-        triangulation.signals.weight.connect(
-#else
-        triangulation.signals.cell_weight.connect(
-#endif
-            [](const auto &cell, const auto /*status*/) -> unsigned int {
-              if (cell->at_boundary())
-                return weight * (speedup == 0u ? 0u : speedup - 1u);
-              else
-                return 0u;
-            });
-
         triangulation.repartition();
       }
     }
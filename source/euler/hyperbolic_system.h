@@ -62,6 +62,17 @@ namespace ryujin
         return HyperbolicSystemView<dim, Number>{*this};
       }
 
+      /**
+       * Values of gamma for which HyperbolicSystemView provides power
+       * kernels specialized at compile time: gamma = 7/5 (diatomic gas)
+       * and gamma = 5/3 (monatomic gas).
+       */
+      enum class GammaPolicy {
+        generic,
+        diatomic,
+        monatomic,
+      };
+
     private:
       /**
        * @name Runtime parameters, internal fields, methods, and friends
@@ -78,6 +89,9 @@ namespace ryujin
       double gamma_minus_one_over_gamma_plus_one_;
       double gamma_plus_one_inverse_;
 
+      bool gamma_specialization_;
+      GammaPolicy gamma_policy_;
+
       template <int dim, typename Number>
       friend class HyperbolicSystemView;
       //@}
@@ -196,6 +210,48 @@ namespace ryujin
        */
       static constexpr bool have_eos_interpolation_b = false;
 
+      //@}
+      /**
+       * @name Specialized power kernels
+       *
+       * For gamma = 7/5 and gamma = 5/3 some of the powers occurring in
+       * the approximate Riemann solver have integer exponents and can be
+       * computed with a few multiplications instead of a call to
+       * ryujin::pow(). The kernels take the GammaPolicy as a template
+       * parameter, so that the choice is resolved at compile time. The
+       * RiemannSolver reads the policy selected by the HyperbolicSystem
+       * (see gamma_policy()) once per call and dispatches into a code
+       * path instantiated for that policy.
+       */
+      //@{
+
+      /**
+       * Return the GammaPolicy selected by the HyperbolicSystem.
+       */
+      DEAL_II_ALWAYS_INLINE inline auto gamma_policy() const
+      {
+        return hyperbolic_system_.gamma_policy_;
+      }
+
+      /**
+       * Return \f$x^{2\gamma/(\gamma-1)}\f$. The exponent is 7 for
+       * gamma = 7/5 and 5 for gamma = 5/3.
+       */
+      template <HyperbolicSystem::GammaPolicy policy, typename T>
+      DEAL_II_ALWAYS_INLINE inline T
+      pow_two_gamma_over_gamma_minus_one(const T &x) const
+      {
+        using GammaPolicy = HyperbolicSystem::GammaPolicy;
+        if constexpr (policy == GammaPolicy::diatomic)
+          return ryujin::fixed_power<7>(x);
+        else if constexpr (policy == GammaPolicy::monatomic)
+          return ryujin::fixed_power<5>(x);
+        else
+          return ryujin::pow(x,
+                             ScalarNumber(2.0) * gamma() *
+                                 gamma_minus_one_inverse());
+      }
+
       //@}
       /**
        * @name Internal data
@@ -668,6 +724,12 @@ namespace ryujin
       gamma_ = 7. / 5.;
       add_parameter("gamma", gamma_, "The ratio of specific heats");
 
+      gamma_specialization_ = true;
+      add_parameter("gamma specialization",
+                    gamma_specialization_,
+                    "Use specialized power kernels for gamma = 7/5 and "
+                    "gamma = 5/3");
+
       reference_density_ = 1.;
       add_parameter("reference density",
                     reference_density_,
@@ -692,6 +754,12 @@ namespace ryujin
         gamma_plus_one_inverse_ = 1. / (gamma_ + 1.);
         gamma_minus_one_inverse_ = 1. / (gamma_ - 1.);
         gamma_minus_one_over_gamma_plus_one_ = (gamma_ - 1.) / (gamma_ + 1.);
+
+        gamma_policy_ = GammaPolicy::generic;
+        if (gamma_specialization_ && std::abs(gamma_ - 7. / 5.) < 1.e-12)
+          gamma_policy_ = GammaPolicy::diatomic;
+        else if (gamma_specialization_ && std::abs(gamma_ - 5. / 3.) < 1.e-12)
+          gamma_policy_ = GammaPolicy::monatomic;
       };
 
       compute_inverses();
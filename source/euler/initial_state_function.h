@@ -9,6 +9,8 @@
 
 #include <deal.II/base/function_parser.h>
 
+#include <mutex>
+
 namespace ryujin
 {
   namespace EulerInitialStates
@@ -91,6 +93,9 @@ namespace ryujin
 
       state_type compute(const dealii::Point<dim> &point, Number t) final
       {
+        /* set_time() modifies the shared function parser objects: */
+        std::lock_guard<std::mutex> lock(mutex_);
+
         const auto view = hyperbolic_system_.template view<dim, Number>();
         state_type full_primitive_state;
 
@@ -129,6 +134,8 @@ namespace ryujin
       std::unique_ptr<dealii::FunctionParser<dim>> velocity_y_function_;
       std::unique_ptr<dealii::FunctionParser<dim>> velocity_z_function_;
       std::unique_ptr<dealii::FunctionParser<dim>> pressure_function_;
+
+      std::mutex mutex_;
     };
   } // namespace EulerInitialStates
 } // namespace ryujin
\ No newline at end of file
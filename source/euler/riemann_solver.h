@@ -91,6 +91,8 @@ namespace ryujin
 
       using Parameters = RiemannSolverParameters<ScalarNumber>;
 
+      using GammaPolicy = HyperbolicSystem::GammaPolicy;
+
       //@}
       /**
        * @name Compute wavespeed estimates
@@ -113,6 +115,9 @@ namespace ryujin
        * For two given 1D primitive states riemann_data_i and riemann_data_j,
        * compute an estimation of an upper bound for the maximum wavespeed
        * lambda.
+       *
+       * The function reads the GammaPolicy of the HyperbolicSystem and
+       * calls compute_with_policy() instantiated for that policy.
        */
       Number compute(const primitive_type &riemann_data_i,
                      const primitive_type &riemann_data_j) const;
@@ -136,6 +141,14 @@ namespace ryujin
       /** @name Internal functions used in the Riemann solver */
       //@{
 
+      /**
+       * The implementation of compute() for a given GammaPolicy @p
+       * policy.
+       */
+      template <HyperbolicSystem::GammaPolicy policy>
+      Number compute_with_policy(const primitive_type &riemann_data_i,
+                                 const primitive_type &riemann_data_j) const;
+
       /**
        * See @cite GuermondPopov2016b, page 912, (3.4).
        *
@@ -245,7 +258,9 @@ namespace ryujin
        * See @cite GuermondPopov2016b, page 914, (4.3)
        *
        * Cost: 2x pow, 2x division, 0x sqrt
+       *       (1x pow for gamma = 7/5 and gamma = 5/3)
        */
+      template <HyperbolicSystem::GammaPolicy policy>
       Number p_star_two_rarefaction(const primitive_type &riemann_data_i,
                                     const primitive_type &riemann_data_j) const;
 
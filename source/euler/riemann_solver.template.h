@@ -270,8 +270,10 @@ namespace ryujin
      * See [1], page 914, (4.3)
      *
      * Cost: 2x pow, 2x division, 0x sqrt
+     *       (1x pow for gamma = 7/5 and gamma = 5/3)
      */
     template <int dim, typename Number>
+    template <HyperbolicSystem::GammaPolicy policy>
     DEAL_II_ALWAYS_INLINE inline Number
     RiemannSolver<dim, Number>::p_star_two_rarefaction(
         const primitive_type &riemann_data_i,
@@ -280,7 +282,6 @@ namespace ryujin
       const auto view = hyperbolic_system.view<dim, Number>();
       const auto &gamma = view.gamma();
       const auto &gamma_inverse = view.gamma_inverse();
-      const auto &gamma_minus_one_inverse = view.gamma_minus_one_inverse();
 
       const auto &[rho_i, u_i, p_i, a_i] = riemann_data_i;
       const auto &[rho_j, u_j, p_j, a_j] = riemann_data_j;
@@ -307,10 +308,15 @@ namespace ryujin
       const Number denominator =
           a_i * ryujin::pow(p_i * inv_p_j, -factor * gamma_inverse) + a_j;
 
-      const auto exponent = ScalarNumber(2.0) * gamma * gamma_minus_one_inverse;
+      /*
+       * The exponent 2 gamma / (gamma - 1) is an integer for gamma = 7/5
+       * and gamma = 5/3, in which case the power is computed with a few
+       * multiplications:
+       */
 
       const auto p_1_tilde =
-          p_j * ryujin::pow(numerator / denominator, exponent);
+          p_j * view.template pow_two_gamma_over_gamma_minus_one<policy>(
+                    numerator / denominator);
 
 #ifdef DEBUG_RIEMANN_SOLVER
       std::cout << "p_star_two_rarefaction = " << p_1_tilde << std::endl;
@@ -407,6 +413,32 @@ namespace ryujin
     Number RiemannSolver<dim, Number>::compute(
         const primitive_type &riemann_data_i,
         const primitive_type &riemann_data_j) const
+    {
+      /*
+       * The gamma policy is a runtime parameter of the HyperbolicSystem.
+       * Branch on it once per call and run a code path in which all
+       * power kernels are resolved at compile time:
+       */
+      switch (hyperbolic_system.view<dim, Number>().gamma_policy()) {
+      case GammaPolicy::diatomic:
+        return compute_with_policy<GammaPolicy::diatomic>(riemann_data_i,
+                                                          riemann_data_j);
+      case GammaPolicy::monatomic:
+        return compute_with_policy<GammaPolicy::monatomic>(riemann_data_i,
+                                                           riemann_data_j);
+      default:
+        return compute_with_policy<GammaPolicy::generic>(riemann_data_i,
+                                                         riemann_data_j);
+      }
+    }
+
+
+    template <int dim, typename Number>
+    template <HyperbolicSystem::GammaPolicy policy>
+    DEAL_II_ALWAYS_INLINE inline Number
+    RiemannSolver<dim, Number>::compute_with_policy(
+        const primitive_type &riemann_data_i,
+        const primitive_type &riemann_data_j) const
     {
       /*
        * For exactly solving the Riemann problem we need to start with a
@@ -472,7 +504,7 @@ namespace ryujin
       const Number p_max = std::max(p_i, p_j);
 
       const Number rarefaction =
-          p_star_two_rarefaction(riemann_data_i, riemann_data_j);
+          p_star_two_rarefaction<policy>(riemann_data_i, riemann_data_j);
       const Number failsafe = p_star_failsafe(riemann_data_i, riemann_data_j);
       const Number p_star_tilde = std::min(rarefaction, failsafe);
 
@@ -24,6 +24,12 @@ namespace ryujin
      * A small abstract base class to group configuration options for an
      * equation of state.
      *
+     * In addition to the virtual interface, derived classes may provide
+     * non-virtual function templates pressure(), specific_internal_energy(),
+     * speed_of_sound(), and temperature() with the same names. These can
+     * be instantiated for double, float, and dealii::VectorizedArray types
+     * and are used by the HyperbolicSystem for vectorized evaluation.
+     *
      * @ingroup EulerEquations
      */
     class EquationOfState : public dealii::ParameterAcceptor
@@ -192,6 +198,11 @@ namespace ryujin
        * memory locality with how we store precomputed values) and less
        * memory consumption. On the other hand, some tabulated equation of
        * state libraries work best with a single call and a large dataset.
+       *
+       * @note The precomputation loop calls the vector interface
+       * concurrently from all threads, each with a disjoint chunk of
+       * values. Derived classes that set this flag must therefore provide
+       * a thread-safe implementation.
        */
       ACCESSOR_READ_ONLY(prefer_vector_interface)
 
@@ -7,6 +7,8 @@
 
 #include "equation_of_state.h"
 
+#include <simd.h>
+
 namespace ryujin
 {
   namespace EquationOfStateLibrary
@@ -64,17 +66,30 @@ namespace ryujin
        *     + \omega \rho (e + q_0)
        * \f}
        */
-      double pressure(double rho, double e) const final
+      template <typename Number>
+      DEAL_II_ALWAYS_INLINE inline Number pressure(const Number &rho,
+                                                   const Number &e) const
       {
+        using ScalarNumber = typename get_value_type<Number>::type;
 
-        const auto ratio = rho / rho_0;
+        const auto ratio = rho / ScalarNumber(rho_0);
 
         const auto first_term =
-            capA * (1. - omega / R1 * ratio) * std::exp(-R1 * 1. / ratio);
+            ScalarNumber(capA) *
+            (ScalarNumber(1.) - ScalarNumber(omega / R1) * ratio) *
+            std::exp(ScalarNumber(-R1) / ratio);
         const auto second_term =
-            capB * (1. - omega / R2 * ratio) * std::exp(-R2 * 1. / ratio);
+            ScalarNumber(capB) *
+            (ScalarNumber(1.) - ScalarNumber(omega / R2) * ratio) *
+            std::exp(ScalarNumber(-R2) / ratio);
 
-        return first_term + second_term + omega * rho * (e + q_0);
+        return first_term + second_term +
+               ScalarNumber(omega) * rho * (e + ScalarNumber(q_0));
+      }
+
+      double pressure(double rho, double e) const final
+      {
+        return pressure<double>(rho, e);
       }
 
       /**
@@ -85,16 +100,29 @@ namespace ryujin
        *   - B(1 - \omega / R_2 \rho/ \rho_0) e^{(-R_2 \rho_0 / \rho)}
        * \f}
        */
-      double specific_internal_energy(double rho, double p) const final
+      template <typename Number>
+      DEAL_II_ALWAYS_INLINE inline Number
+      specific_internal_energy(const Number &rho, const Number &p) const
       {
-        const auto ratio = rho / rho_0;
+        using ScalarNumber = typename get_value_type<Number>::type;
+
+        const auto ratio = rho / ScalarNumber(rho_0);
 
         const auto first_term =
-            capA * (1. - omega / R1 * ratio) * std::exp(-R1 * 1. / ratio);
+            ScalarNumber(capA) *
+            (ScalarNumber(1.) - ScalarNumber(omega / R1) * ratio) *
+            std::exp(ScalarNumber(-R1) / ratio);
         const auto second_term =
-            capB * (1. - omega / R2 * ratio) * std::exp(-R2 * 1. / ratio);
+            ScalarNumber(capB) *
+            (ScalarNumber(1.) - ScalarNumber(omega / R2) * ratio) *
+            std::exp(ScalarNumber(-R2) / ratio);
 
-        return (p - first_term - second_term) / (rho * omega);
+        return (p - first_term - second_term) / (rho * ScalarNumber(omega));
+      }
+
+      double specific_internal_energy(double rho, double p) const final
+      {
+        return specific_internal_energy<double>(rho, p);
       }
 
       /**
@@ -104,39 +132,71 @@ namespace ryujin
        *         + B / R_2 * e^{(-R_2 \rho_0 / \rho)})
        * \f}
        */
-      double temperature(double rho, double e) const final
+      template <typename Number>
+      DEAL_II_ALWAYS_INLINE inline Number temperature(const Number &rho,
+                                                      const Number &e) const
       {
+        using ScalarNumber = typename get_value_type<Number>::type;
+
         /* Using (16a) of LA-UR-15-29536 */
-        const auto ratio = rho / rho_0;
+        const auto ratio = rho / ScalarNumber(rho_0);
 
-        const auto first_term = capA / R1 * std::exp(-R1 * 1. / ratio);
-        const auto second_term = capB / R2 * std::exp(-R2 * 1. / ratio);
+        const auto first_term =
+            ScalarNumber(capA / R1) *
+            std::exp(ScalarNumber(-R1) / ratio);
+        const auto second_term =
+            ScalarNumber(capB / R2) *
+            std::exp(ScalarNumber(-R2) / ratio);
 
-        return (e + q_0 - 1. / rho_0 * (first_term + second_term)) / cv_;
+        return (e + ScalarNumber(q_0) -
+                ScalarNumber(1. / rho_0) * (first_term + second_term)) /
+               ScalarNumber(cv_);
+      }
+
+      double temperature(double rho, double e) const final
+      {
+        return temperature<double>(rho, e);
       }
 
       /**
        * The speed of sound is given by
        */
-      double speed_of_sound(double rho, double e) const final
+      template <typename Number>
+      DEAL_II_ALWAYS_INLINE inline Number speed_of_sound(const Number &rho,
+                                                         const Number &e) const
       {
+        using ScalarNumber = typename get_value_type<Number>::type;
+
         /* FIXME: Need to cross reference with literature */
 
-        const auto t1 = omega * rho / (R1 * rho_0);
-        const auto factor1 = omega * (1. - t1) * (1. + 1. / t1) - t1;
+        const auto t1 = ScalarNumber(omega) * rho / ScalarNumber(R1 * rho_0);
+        const auto factor1 =
+            ScalarNumber(omega) * (ScalarNumber(1.) - t1) *
+                (ScalarNumber(1.) + ScalarNumber(1.) / t1) -
+            t1;
         const auto first_term =
-            capA / rho * factor1 * std::exp(-1. / t1 / omega);
-
-        const auto t2 = omega * rho / (R2 * rho_0);
-        const auto factor2 = omega * (1. - t2) * (1. + 1. / t2) - t2;
+            ScalarNumber(capA) / rho * factor1 *
+            std::exp(ScalarNumber(-1.) / t1 / ScalarNumber(omega));
+
+        const auto t2 = ScalarNumber(omega) * rho / ScalarNumber(R2 * rho_0);
+        const auto factor2 =
+            ScalarNumber(omega) * (ScalarNumber(1.) - t2) *
+                (ScalarNumber(1.) + ScalarNumber(1.) / t2) -
+            t2;
         const auto second_term =
-            capB / rho * factor2 * std::exp(-1. / t2 / omega);
+            ScalarNumber(capB) / rho * factor2 *
+            std::exp(ScalarNumber(-1.) / t2 / ScalarNumber(omega));
 
-        const auto third_term = omega * (omega + 1.) * e;
+        const auto third_term = ScalarNumber(omega * (omega + 1.)) * e;
 
         return std::sqrt(first_term + second_term + third_term);
       }
 
+      double speed_of_sound(double rho, double e) const final
+      {
+        return speed_of_sound<double>(rho, e);
+      }
+
     private:
       double capA;
       double capB;
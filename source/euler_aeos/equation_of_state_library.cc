@@ -10,6 +10,7 @@
 #include "equation_of_state_noble_abel_stiffened_gas.h"
 #include "equation_of_state_polytropic_gas.h"
 #include "equation_of_state_sesame.h"
+#include "equation_of_state_tabulated.h"
 #include "equation_of_state_van_der_waals.h"
 
 namespace ryujin
@@ -25,7 +26,8 @@ namespace ryujin
 
     void populate_equation_of_state_list(
         equation_of_state_list_type &equation_of_state_list,
-        const std::string &subsection)
+        const std::string &subsection,
+        const MPI_Comm &mpi_communicator)
     {
       auto add = [&](auto &&object) {
         equation_of_state_list.emplace(std::move(object));
@@ -36,6 +38,7 @@ namespace ryujin
       add(std::make_shared<NobleAbelStiffenedGas>(subsection));
       add(std::make_shared<PolytropicGas>(subsection));
       add(std::make_shared<Sesame>(subsection));
+      add(std::make_shared<Tabulated>(subsection, mpi_communicator));
       add(std::make_shared<VanDerWaals>(subsection));
     }
   } // namespace EquationOfStateLibrary
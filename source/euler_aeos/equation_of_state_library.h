@@ -7,6 +7,8 @@
 
 #include "equation_of_state.h"
 
+#include <deal.II/base/mpi.h>
+
 namespace ryujin
 {
   namespace EquationOfStateLibrary
@@ -16,13 +18,15 @@ namespace ryujin
 
     /**
      * Populate a given container with all equation of states defined in
-     * this namespace.
+     * this namespace. Equations of state that read tables collectively
+     * (see Tabulated) use the MPI communicator @p mpi_communicator.
      *
      * @ingroup EulerEquations
      */
     void populate_equation_of_state_list(
         equation_of_state_list_type &equation_of_state_list,
-        const std::string &subsection);
+        const std::string &subsection,
+        const MPI_Comm &mpi_communicator = MPI_COMM_WORLD);
 
   } // namespace EquationOfStateLibrary
 } // namespace ryujin
@@ -7,6 +7,8 @@
 
 #include "equation_of_state.h"
 
+#include <simd.h>
+
 namespace ryujin
 {
   namespace EquationOfStateLibrary
@@ -66,12 +68,20 @@ namespace ryujin
        *   p = (\gamma - 1) \rho (e - q) / (1 - b \rho) - \gamma p_\infty
        * \f}
        */
-      double pressure(double rho, double e) const final
+      template <typename Number>
+      DEAL_II_ALWAYS_INLINE inline Number pressure(const Number &rho,
+                                                   const Number &e) const
       {
-        return (gamma_ - 1.) * rho * (e - q_) / (1. - b_ * rho) -
-               gamma_ * pinf_;
+        using ScalarNumber = typename get_value_type<Number>::type;
+        return ScalarNumber(gamma_ - 1.) * rho * (e - ScalarNumber(q_)) /
+                   (ScalarNumber(1.) - ScalarNumber(b_) * rho) -
+               ScalarNumber(gamma_ * pinf_);
       }
 
+      double pressure(double rho, double e) const final
+      {
+        return pressure<double>(rho, e);
+      }
 
       /**
        * The specific internal energy is given by
@@ -79,11 +89,20 @@ namespace ryujin
        *   e - q = (p + \gamma p_\infty) * (1 - b \rho) / (\rho (\gamma - 1))
        * \f}
        */
+      template <typename Number>
+      DEAL_II_ALWAYS_INLINE inline Number
+      specific_internal_energy(const Number &rho, const Number &p) const
+      {
+        using ScalarNumber = typename get_value_type<Number>::type;
+        const auto numerator = (p + ScalarNumber(gamma_ * pinf_)) *
+                               (ScalarNumber(1.) - ScalarNumber(b_) * rho);
+        const auto denominator = rho * ScalarNumber(gamma_ - 1.);
+        return ScalarNumber(q_) + numerator / denominator;
+      }
+
       double specific_internal_energy(double rho, double p) const final
       {
-        const auto numerator = (p + gamma_ * pinf_) * (1. - b_ * rho);
-        const auto denominator = rho * (gamma_ - 1.);
-        return q_ + numerator / denominator;
+        return specific_internal_energy<double>(rho, p);
       }
 
       /**
@@ -92,9 +111,20 @@ namespace ryujin
        *   T = (e - q - p_\infty (1 / rho - b)) / c_v
        * \f}
        */
+      template <typename Number>
+      DEAL_II_ALWAYS_INLINE inline Number temperature(const Number &rho,
+                                                      const Number &e) const
+      {
+        using ScalarNumber = typename get_value_type<Number>::type;
+        return (e - ScalarNumber(q_) -
+                ScalarNumber(pinf_) *
+                    (ScalarNumber(1.) / rho - ScalarNumber(b_))) /
+               ScalarNumber(cv_);
+      }
+
       double temperature(double rho, double e) const final
       {
-        return (e - q_ - pinf_ * (1. / rho - b_)) / cv_;
+        return temperature<double>(rho, e);
       }
 
       /**
@@ -104,14 +134,24 @@ namespace ryujin
        *       = \frac{\gamma (\gamma -1)[\rho (e - q) - p_\infty X]}{\rho X^2}
        * \f}
        */
-      double speed_of_sound(double rho, double e) const final
+      template <typename Number>
+      DEAL_II_ALWAYS_INLINE inline Number speed_of_sound(const Number &rho,
+                                                         const Number &e) const
       {
-        const auto covolume = 1. - b_ * rho;
-        auto numerator = (rho * (e - q_) - pinf_ * covolume) / rho;
-        numerator *= gamma_ * (gamma_ - 1.);
+        using ScalarNumber = typename get_value_type<Number>::type;
+        const auto covolume = ScalarNumber(1.) - ScalarNumber(b_) * rho;
+        auto numerator = (rho * (e - ScalarNumber(q_)) -
+                          ScalarNumber(pinf_) * covolume) /
+                         rho;
+        numerator *= ScalarNumber(gamma_ * (gamma_ - 1.));
         return std::sqrt(numerator) / covolume;
       }
 
+      double speed_of_sound(double rho, double e) const final
+      {
+        return speed_of_sound<double>(rho, e);
+      }
+
     private:
       double gamma_;
       double R_;
@@ -7,6 +7,8 @@
 
 #include "equation_of_state.h"
 
+#include <simd.h>
+
 namespace ryujin
 {
   namespace EquationOfStateLibrary
@@ -48,9 +50,17 @@ namespace ryujin
        *   p = (\gamma - 1) \rho e
        * \f}
        */
+      template <typename Number>
+      DEAL_II_ALWAYS_INLINE inline Number pressure(const Number &rho,
+                                                   const Number &e) const
+      {
+        using ScalarNumber = typename get_value_type<Number>::type;
+        return ScalarNumber(gamma_ - 1.) * rho * e;
+      }
+
       double pressure(double rho, double e) const final
       {
-        return (gamma_ - 1.) * rho * e;
+        return pressure<double>(rho, e);
       }
 
       /**
@@ -59,9 +69,17 @@ namespace ryujin
        *   e = p / (\rho (\gamma - 1))
        * \f}
        */
+      template <typename Number>
+      DEAL_II_ALWAYS_INLINE inline Number
+      specific_internal_energy(const Number &rho, const Number &p) const
+      {
+        using ScalarNumber = typename get_value_type<Number>::type;
+        return p / (rho * ScalarNumber(gamma_ - 1.));
+      }
+
       double specific_internal_energy(double rho, double p) const final
       {
-        return p / (rho * (gamma_ - 1.));
+        return specific_internal_energy<double>(rho, p);
       }
 
       /**
@@ -70,9 +88,17 @@ namespace ryujin
        *   T = e / c_v
        * \f}
        */
-      double temperature(double /*rho*/, double e) const final
+      template <typename Number>
+      DEAL_II_ALWAYS_INLINE inline Number
+      temperature(const Number & /*rho*/, const Number &e) const
       {
-        return e / cv_;
+        using ScalarNumber = typename get_value_type<Number>::type;
+        return e / ScalarNumber(cv_);
+      }
+
+      double temperature(double rho, double e) const final
+      {
+        return temperature<double>(rho, e);
       }
 
       /**
@@ -81,9 +107,17 @@ namespace ryujin
        *   c^2 = \gamma * (\gamma - 1) e
        * \f}
        */
-      double speed_of_sound(double /*rho*/, double e) const final
+      template <typename Number>
+      DEAL_II_ALWAYS_INLINE inline Number
+      speed_of_sound(const Number & /*rho*/, const Number &e) const
+      {
+        using ScalarNumber = typename get_value_type<Number>::type;
+        return std::sqrt(ScalarNumber(gamma_ * (gamma_ - 1.)) * e);
+      }
+
+      double speed_of_sound(double rho, double e) const final
       {
-        return std::sqrt(gamma_ * (gamma_ - 1.) * e);
+        return speed_of_sound<double>(rho, e);
       }
 
     private:
@@ -14,6 +14,10 @@
 #include <deal.II/base/exceptions.h>
 #include <deal.II/base/parameter_acceptor.h>
 
+#include <openmp.h>
+
+#include <mutex>
+
 #ifdef WITH_EOSPAC
 #include "eos_Interface.h"
 #endif
@@ -207,6 +211,10 @@ namespace ryujin
      *          [p] = Pa = Kg / m / s^2
      *          [e] = J / Kg = N m / Kg = m^2 / s^2
      *
+     * @note EOSPAC loads a private copy of every table on every MPI rank.
+     * In contrast, the "tabulated" equation of state shares a single copy
+     * of its tables among all MPI ranks of a node.
+     *
      * @ingroup EulerEquations
      */
     class Sesame : public EquationOfState
@@ -225,6 +233,14 @@ namespace ryujin
         this->add_parameter(
             "material id", material_id_, "The Sesame Material ID");
 
+        thread_local_tables_ = false;
+        this->add_parameter(
+            "thread local tables",
+            thread_local_tables_,
+            "Load a private copy of the tables for every thread so that "
+            "table lookups can proceed concurrently. If set to false, all "
+            "calls into eospac are serialized.");
+
         this->prefer_vector_interface_ = true;
 
         const auto set_up_database = [&]() {
@@ -233,7 +249,16 @@ namespace ryujin
               {material_id_, eospac::TableType::e_rho_p},
           };
 
-          eospac_interface_ = std::make_unique<eospac::Interface>(tables);
+#ifdef WITH_OPENMP
+          const unsigned int n_interfaces =
+              thread_local_tables_ ? omp_get_max_threads() : 1;
+#else
+          const unsigned int n_interfaces = 1;
+#endif
+          eospac_interfaces_.clear();
+          for (unsigned int i = 0; i < n_interfaces; ++i)
+            eospac_interfaces_.emplace_back(
+                std::make_unique<eospac::Interface>(tables));
         };
 
         this->parse_parameters_call_back.connect(set_up_database);
@@ -248,13 +273,15 @@ namespace ryujin
         const double rho_scaled = rho / 1.0e3; // convert from Kg/m^3 to Mg/m^3
         const double e_scaled = e / 1.0e6;     // convert from J/kg to MJ/kg
 
-        eospac_interface_->interpolate_values(
-            index,
-            dealii::ArrayView<double>(&p, 1),
-            dealii::ArrayView<double>(&p_drho, 1),
-            dealii::ArrayView<double>(&p_de, 1),
-            dealii::ArrayView<const double>(&rho_scaled, 1),
-            dealii::ArrayView<const double>(&e_scaled, 1));
+        with_interface([&](auto &interface) {
+          interface.interpolate_values(
+              index,
+              dealii::ArrayView<double>(&p, 1),
+              dealii::ArrayView<double>(&p_drho, 1),
+              dealii::ArrayView<double>(&p_de, 1),
+              dealii::ArrayView<const double>(&rho_scaled, 1),
+              dealii::ArrayView<const double>(&e_scaled, 1));
+        });
 
         return 1.0e9 * p; // convert from GPa to Pa
       }
@@ -287,12 +314,15 @@ namespace ryujin
                        std::begin(e),
                        [](auto e) { return e / 1.0e6; });
 
-        eospac_interface_->interpolate_values(index,
-                                              p,
-                                              dealii::ArrayView<double>(p_drho),
-                                              dealii::ArrayView<double>(p_de),
-                                              rho,
-                                              e);
+        with_interface([&](auto &interface) {
+          interface.interpolate_values(
+              index,
+              p,
+              dealii::ArrayView<double>(p_drho),
+              dealii::ArrayView<double>(p_de),
+              rho,
+              e);
+        });
 
         // convert from GPa to Pa
         std::transform(std::begin(p), //
@@ -310,13 +340,15 @@ namespace ryujin
         const double rho_scaled = rho / 1.0e3; // convert from Kg/M^3 to Mg/M^3
         const double p_scaled = p / 1.0e9;     // convert from Pa to GPa
 
-        eospac_interface_->interpolate_values(
-            index,
-            dealii::ArrayView<double>(&e, 1),
-            dealii::ArrayView<double>(&e_drho, 1),
-            dealii::ArrayView<double>(&e_dp, 1),
-            dealii::ArrayView<const double>(&rho_scaled, 1),
-            dealii::ArrayView<const double>(&p_scaled, 1));
+        with_interface([&](auto &interface) {
+          interface.interpolate_values(
+              index,
+              dealii::ArrayView<double>(&e, 1),
+              dealii::ArrayView<double>(&e_drho, 1),
+              dealii::ArrayView<double>(&e_dp, 1),
+              dealii::ArrayView<const double>(&rho_scaled, 1),
+              dealii::ArrayView<const double>(&p_scaled, 1));
+        });
 
         return 1.0e6 * e; // convert from MJ/kg to J/kg
       }
@@ -350,12 +382,15 @@ namespace ryujin
                        std::begin(p),
                        [](auto it) { return it / 1.0e9; });
 
-        eospac_interface_->interpolate_values(index,
-                                              e,
-                                              dealii::ArrayView<double>(e_drho),
-                                              dealii::ArrayView<double>(e_dp),
-                                              rho,
-                                              p);
+        with_interface([&](auto &interface) {
+          interface.interpolate_values(
+              index,
+              e,
+              dealii::ArrayView<double>(e_drho),
+              dealii::ArrayView<double>(e_dp),
+              rho,
+              p);
+        });
 
         // convert from MJ/kg to J/kg
         std::transform(std::begin(e), //
@@ -392,8 +427,35 @@ namespace ryujin
       }
 
     private:
+      /**
+       * Call @p payload with an eospac::Interface that the calling thread
+       * can use safely. eospac itself is not thread-safe: with thread
+       * local tables every thread uses its own interface, otherwise all
+       * calls are serialized with a mutex.
+       */
+      template <typename PAYLOAD>
+      DEAL_II_ALWAYS_INLINE inline void
+      with_interface(const PAYLOAD &payload) const
+      {
+#ifdef WITH_OPENMP
+        if (eospac_interfaces_.size() > 1) {
+          const unsigned int thread = omp_get_thread_num();
+          AssertThrow(thread < eospac_interfaces_.size(),
+                      dealii::ExcMessage("More threads than thread local "
+                                         "table copies"));
+          payload(*eospac_interfaces_[thread]);
+          return;
+        }
+#endif
+        std::lock_guard<std::mutex> lock(eospac_mutex_);
+        payload(*eospac_interfaces_[0]);
+      }
+
       EOS_INTEGER material_id_;
-      std::unique_ptr<eospac::Interface> eospac_interface_;
+      bool thread_local_tables_;
+
+      std::vector<std::unique_ptr<eospac::Interface>> eospac_interfaces_;
+      mutable std::mutex eospac_mutex_;
 
 #else /* WITHOUT_EOSPAC */
 
@@ -0,0 +1,597 @@
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright (C) 2024 by the ryujin authors
+//
+
+#pragma once
+
+#include "equation_of_state.h"
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/mpi.h>
+
+#include <shared_memory_window.h>
+#include <simd.h>
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+namespace ryujin
+{
+  namespace EquationOfStateLibrary
+  {
+    /**
+     * A two dimensional table f(x, y) sampled on a tensor product grid
+     * with logarithmically spaced axes. Values are stored row by row
+     * (with y as the fast index). The table either owns its values (in a
+     * cache-line aligned array), or it is attached to an externally
+     * managed read-only buffer, see attach().
+     *
+     * @ingroup EulerEquations
+     */
+    class LogSpacedTable
+    {
+    public:
+      /**
+       * Alignment (in bytes) of all sections of a table in binary format.
+       */
+      static constexpr std::size_t alignment = 64;
+
+      /**
+       * Return @p size rounded up to the next multiple of alignment.
+       */
+      static constexpr std::size_t aligned_size(const std::size_t size)
+      {
+        return (size + alignment - 1) / alignment * alignment;
+      }
+
+      /**
+       * Reinitialize the table for @p n_x times @p n_y sample points in
+       * the range [x_min, x_max] x [y_min, y_max]. All bounds have to be
+       * positive. Values are initialized to zero.
+       */
+      void reinit(const unsigned int n_x,
+                  const unsigned int n_y,
+                  const double x_min,
+                  const double x_max,
+                  const double y_min,
+                  const double y_max)
+      {
+        set_axes(n_x, n_y, x_min, x_max, y_min, y_max);
+
+        values_.resize(std::size_t(n_x) * n_y);
+        values_.fill(0.);
+        data_ = values_.data();
+      }
+
+      /**
+       * Attach the table to a table in binary format (see write()) that
+       * is stored in the buffer [@p begin, @p end). The table values are
+       * not copied, thus the buffer has to outlive the table. The
+       * function returns a pointer past the end of the table.
+       *
+       * All sections of the binary format are padded to a multiple of
+       * alignment bytes. Thus, if @p begin is cache-line aligned, so are
+       * the table values.
+       */
+      const char *attach(const char *begin, const char *end)
+      {
+        std::array<std::uint32_t, 2> sizes;
+        std::array<double, 4> bounds;
+        const auto header_size = aligned_size(sizeof(sizes) + sizeof(bounds));
+        AssertThrow(std::size_t(end - begin) >= header_size,
+                    dealii::ExcMessage("Could not read table header"));
+        std::memcpy(sizes.data(), begin, sizeof(sizes));
+        std::memcpy(bounds.data(), begin + sizeof(sizes), sizeof(bounds));
+        begin += header_size;
+
+        const auto &[x_min, x_max, y_min, y_max] = bounds;
+        set_axes(sizes[0], sizes[1], x_min, x_max, y_min, y_max);
+
+        const std::size_t size = std::size_t(n_x_) * n_y_ * sizeof(double);
+        AssertThrow(std::size_t(end - begin) >= aligned_size(size),
+                    dealii::ExcMessage("Could not read table values"));
+        const auto address = reinterpret_cast<std::uintptr_t>(begin);
+        AssertThrow(address % sizeof(double) == 0,
+                    dealii::ExcMessage("Table values are not aligned"));
+
+        values_.clear();
+        data_ = reinterpret_cast<const double *>(begin);
+        return begin + aligned_size(size);
+      }
+
+      /**
+       * Return the coordinate of the @p i th sample point in x direction.
+       */
+      double x(const unsigned int i) const
+      {
+        return std::exp(log_x_min_ + i / inverse_dlog_x_);
+      }
+
+      /**
+       * Return the coordinate of the @p j th sample point in y direction.
+       */
+      double y(const unsigned int j) const
+      {
+        return std::exp(log_y_min_ + j / inverse_dlog_y_);
+      }
+
+      /**
+       * Return a pointer to the (row major) table values.
+       */
+      const double *data() const
+      {
+        return data_;
+      }
+
+      /**
+       * Return a reference to the value at sample point (@p i, @p j).
+       * This requires that the table owns its values, i.e., that it has
+       * been set up with reinit().
+       */
+      double &operator()(const unsigned int i, const unsigned int j)
+      {
+        Assert(data_ == values_.data(), dealii::ExcInternalError());
+        return values_[std::size_t(i) * n_y_ + j];
+      }
+
+      /**
+       * Bilinear interpolation in (log x, log y). Arguments outside of the
+       * tabulated range (including zero and negative arguments) are
+       * clamped to the boundary of the table before taking the logarithm.
+       *
+       * The index computation and the interpolation are vectorized, only
+       * the gather of the four surrounding table values is performed lane
+       * by lane.
+       */
+      template <typename Number>
+      DEAL_II_ALWAYS_INLINE inline Number interpolate(const Number &x,
+                                                      const Number &y) const
+      {
+        using ScalarNumber = typename get_value_type<Number>::type;
+
+        Assert(data_ != nullptr, dealii::ExcNotInitialized());
+
+        const auto clamp = [](const Number &z, double lower, double upper) {
+          return std::min(std::max(z, Number(ScalarNumber(lower))),
+                          Number(ScalarNumber(upper)));
+        };
+
+        /* Fractional indices into the table: */
+        const Number s =
+            (std::log(clamp(x, bounds_[0], bounds_[1])) -
+             ScalarNumber(log_x_min_)) *
+            ScalarNumber(inverse_dlog_x_);
+        const Number t =
+            (std::log(clamp(y, bounds_[2], bounds_[3])) -
+             ScalarNumber(log_y_min_)) *
+            ScalarNumber(inverse_dlog_y_);
+
+        Number v_00, v_01, v_10, v_11, s_frac, t_frac;
+
+        /*
+         * Clamp the cell index to [0, n - 2]. Rounding in the logarithm
+         * may push a fractional index slightly outside of [0, n - 1], and
+         * a NaN argument must not reach the conversion to an integer:
+         */
+        const auto index = [](const ScalarNumber s, const unsigned int n) {
+          if (!(s > ScalarNumber(0.)))
+            return 0u;
+          if (s < ScalarNumber(n - 2))
+            return static_cast<unsigned int>(s);
+          return n - 2;
+        };
+
+        const auto gather = [&](const ScalarNumber s, const ScalarNumber t) {
+          const auto i = index(s, n_x_);
+          const auto j = index(t, n_y_);
+          const double *row_0 = data_ + std::size_t(i) * n_y_ + j;
+          const double *row_1 = row_0 + n_y_;
+          return std::array<ScalarNumber, 6>{ScalarNumber(row_0[0]),
+                                             ScalarNumber(row_0[1]),
+                                             ScalarNumber(row_1[0]),
+                                             ScalarNumber(row_1[1]),
+                                             ScalarNumber(s - i),
+                                             ScalarNumber(t - j)};
+        };
+
+        if constexpr (std::is_same_v<ScalarNumber, Number>) {
+          const auto lane = gather(s, t);
+          v_00 = lane[0];
+          v_01 = lane[1];
+          v_10 = lane[2];
+          v_11 = lane[3];
+          s_frac = lane[4];
+          t_frac = lane[5];
+        } else {
+          for (unsigned int k = 0; k < Number::size(); ++k) {
+            const auto lane = gather(s[k], t[k]);
+            v_00[k] = lane[0];
+            v_01[k] = lane[1];
+            v_10[k] = lane[2];
+            v_11[k] = lane[3];
+            s_frac[k] = lane[4];
+            t_frac[k] = lane[5];
+          }
+        }
+
+        const Number v_0 = v_00 + t_frac * (v_01 - v_00);
+        const Number v_1 = v_10 + t_frac * (v_11 - v_10);
+        return v_0 + s_frac * (v_1 - v_0);
+      }
+
+      /**
+       * Write the table in binary format to @p output: two 32 bit
+       * unsigned integers (number of sample points in x and y), four
+       * doubles (the bounds x_min, x_max, y_min, y_max), and the (row
+       * major) table values as doubles. The header and the values are
+       * padded with zeros to a multiple of alignment bytes.
+       */
+      void write(std::ostream &output) const
+      {
+        const std::array<std::uint32_t, 2> sizes{{n_x_, n_y_}};
+        output.write(reinterpret_cast<const char *>(sizes.data()),
+                     sizeof(sizes));
+        output.write(reinterpret_cast<const char *>(bounds_.data()),
+                     sizeof(bounds_));
+        write_padding(output, sizeof(sizes) + sizeof(bounds_));
+
+        const std::size_t size = std::size_t(n_x_) * n_y_ * sizeof(double);
+        output.write(reinterpret_cast<const char *>(data_), size);
+        write_padding(output, size);
+      }
+
+      /**
+       * Write zeros to @p output to pad a section of @p size bytes to
+       * a multiple of alignment bytes.
+       */
+      static void write_padding(std::ostream &output, const std::size_t size)
+      {
+        const std::array<char, alignment> zeros{};
+        output.write(zeros.data(), aligned_size(size) - size);
+      }
+
+    private:
+      void set_axes(const unsigned int n_x,
+                    const unsigned int n_y,
+                    const double x_min,
+                    const double x_max,
+                    const double y_min,
+                    const double y_max)
+      {
+        AssertThrow(n_x >= 2 && n_y >= 2,
+                    dealii::ExcMessage("A table needs at least two sample "
+                                       "points in every direction"));
+        AssertThrow(0. < x_min && x_min < x_max && 0. < y_min && y_min < y_max,
+                    dealii::ExcMessage("Invalid table bounds: bounds have to "
+                                       "be positive and in ascending order"));
+
+        n_x_ = n_x;
+        n_y_ = n_y;
+        bounds_ = {x_min, x_max, y_min, y_max};
+
+        log_x_min_ = std::log(x_min);
+        log_y_min_ = std::log(y_min);
+        inverse_dlog_x_ = (n_x - 1) / (std::log(x_max) - log_x_min_);
+        inverse_dlog_y_ = (n_y - 1) / (std::log(y_max) - log_y_min_);
+      }
+
+      unsigned int n_x_ = 0;
+      unsigned int n_y_ = 0;
+      std::array<double, 4> bounds_;
+
+      double log_x_min_;
+      double log_y_min_;
+      double inverse_dlog_x_;
+      double inverse_dlog_y_;
+
+      dealii::AlignedVector<double> values_;
+      const double *data_ = nullptr;
+    };
+
+
+    /**
+     * A tabulated equation of state that interpolates the pressure
+     * p(rho, e), the specific internal energy e(rho, p), and the speed of
+     * sound c(rho, e) from tables with logarithmically spaced axes.
+     *
+     * The tables are read from a binary file that can be created with
+     * the `scripts/create_eos_table` converter, or with the write()
+     * function. The file consists of the 8 byte signature "ryujinEO" and
+     * a 32 bit version number (padded with zeros to 64 bytes), and the
+     * three tables p(rho, e), e(rho, p), and c(rho, e) in this order, see
+     * LogSpacedTable::write() for the layout of a table (with rho as the
+     * first variable). All values are in native byte order and in SI
+     * units. The padding ensures that all table values start at a 64 byte
+     * offset within the file, so that the tables can be used in place and
+     * are cache-line aligned.
+     *
+     * By default the table file is read only once per node: one MPI rank
+     * per node reads the file into a node-local MPI-3 shared memory
+     * window and all MPI ranks of the node interpolate from this single
+     * read-only copy. The node-local communicator is split off from the
+     * MPI communicator passed to the constructor.
+     *
+     * Values outside of the tabulated range are clamped to the boundary
+     * of the table.
+     *
+     * @ingroup EulerEquations
+     */
+    class Tabulated : public EquationOfState
+    {
+    public:
+      using EquationOfState::pressure;
+      using EquationOfState::specific_internal_energy;
+      using EquationOfState::speed_of_sound;
+      using EquationOfState::temperature;
+
+      static constexpr std::array<char, 8> signature{
+          {'r', 'y', 'u', 'j', 'i', 'n', 'E', 'O'}};
+      static constexpr std::uint32_t version = 3;
+
+      Tabulated(const std::string &subsection,
+                const MPI_Comm &mpi_communicator = MPI_COMM_WORLD)
+          : EquationOfState("tabulated", subsection)
+          , mpi_communicator_(mpi_communicator)
+      {
+        table_file_ = "";
+        this->add_parameter("table file",
+                            table_file_,
+                            "Binary table file containing p(rho, e), "
+                            "e(rho, p), and c(rho, e)");
+
+        node_shared_tables_ = true;
+        this->add_parameter("node shared tables",
+                            node_shared_tables_,
+                            "Read the table file once per node and share "
+                            "the tables among all MPI ranks of the node");
+
+        interpolation_b_ = 0.;
+        this->add_parameter("interpolation covolume b",
+                            interpolation_b_,
+                            "The interpolation co-volume b used in the "
+                            "approximate Riemann solver");
+
+        const auto read_tables = [this]() {
+          if (!table_file_.empty())
+            read(table_file_);
+        };
+        ParameterAcceptor::parse_parameters_call_back.connect(read_tables);
+      }
+
+      /**
+       * Interpolate the pressure from the p(rho, e) table.
+       */
+      template <typename Number>
+      DEAL_II_ALWAYS_INLINE inline Number pressure(const Number &rho,
+                                                   const Number &e) const
+      {
+        return p_rho_e_.interpolate(rho, e);
+      }
+
+      double pressure(double rho, double e) const final
+      {
+        return pressure<double>(rho, e);
+      }
+
+      /**
+       * Interpolate the specific internal energy from the e(rho, p)
+       * table.
+       */
+      template <typename Number>
+      DEAL_II_ALWAYS_INLINE inline Number
+      specific_internal_energy(const Number &rho, const Number &p) const
+      {
+        return e_rho_p_.interpolate(rho, p);
+      }
+
+      double specific_internal_energy(double rho, double p) const final
+      {
+        return specific_internal_energy<double>(rho, p);
+      }
+
+      /**
+       * The tabulated equation of state does not provide a temperature.
+       */
+      template <typename Number>
+      Number temperature(const Number & /*rho*/, const Number & /*e*/) const
+      {
+        AssertThrow(false,
+                    dealii::ExcMessage("The tabulated equation of state does "
+                                       "not provide a temperature"));
+        __builtin_trap();
+      }
+
+      double temperature(double rho, double e) const final
+      {
+        return temperature<double>(rho, e);
+      }
+
+      /**
+       * Interpolate the speed of sound from the c(rho, e) table.
+       */
+      template <typename Number>
+      DEAL_II_ALWAYS_INLINE inline Number speed_of_sound(const Number &rho,
+                                                         const Number &e) const
+      {
+        return c_rho_e_.interpolate(rho, e);
+      }
+
+      double speed_of_sound(double rho, double e) const final
+      {
+        return speed_of_sound<double>(rho, e);
+      }
+
+      /**
+       * Read the tables from the binary file @p file_name.
+       *
+       * If MPI is initialized and "node shared tables" is set, the file
+       * is read by one MPI rank per node into a shared memory window. In
+       * this case the function is collective over the MPI communicator
+       * passed to the constructor.
+       */
+      void read(const std::string &file_name)
+      {
+        const char *begin = nullptr;
+        std::uint64_t size = 0;
+
+        if (node_shared_tables_ && dealii::Utilities::MPI::job_supports_mpi()) {
+          MPI_Comm node_communicator;
+          int ierr = MPI_Comm_split_type(mpi_communicator_,
+                                         MPI_COMM_TYPE_SHARED,
+                                         0,
+                                         MPI_INFO_NULL,
+                                         &node_communicator);
+          AssertThrowMPI(ierr);
+
+          const bool node_leader =
+              dealii::Utilities::MPI::this_mpi_process(node_communicator) == 0;
+
+          if (node_leader)
+            size = file_size(file_name);
+          ierr = MPI_Bcast(&size, 1, MPI_UINT64_T, 0, node_communicator);
+          AssertThrowMPI(ierr);
+          AssertThrow(size != 0,
+                      dealii::ExcMessage("Could not open table file \"" +
+                                         file_name + "\""));
+
+          /*
+           * Allocate one additional cache line and place the file at a
+           * cache-line boundary of the segment of the node leader:
+           */
+          constexpr auto alignment = LogSpacedTable::alignment;
+          shared_window_.reinit(node_communicator,
+                                node_leader ? size + alignment : 0);
+
+          std::uint64_t offset = 0;
+          if (node_leader) {
+            const auto address = reinterpret_cast<std::uintptr_t>(
+                shared_window_.local_memory());
+            offset = (alignment - address % alignment) % alignment;
+            read_file(
+                file_name, shared_window_.local_memory() + offset, size);
+          }
+          ierr = MPI_Bcast(&offset, 1, MPI_UINT64_T, 0, node_communicator);
+          AssertThrowMPI(ierr);
+
+          /* Make the table visible to all MPI ranks of the node: */
+          shared_window_.sync();
+          ierr = MPI_Barrier(node_communicator);
+          AssertThrowMPI(ierr);
+          shared_window_.sync();
+
+          ierr = MPI_Comm_free(&node_communicator);
+          AssertThrowMPI(ierr);
+
+          buffer_.clear();
+          begin = shared_window_.memory(0) + offset;
+
+        } else {
+          size = file_size(file_name);
+          AssertThrow(size != 0,
+                      dealii::ExcMessage("Could not open table file \"" +
+                                         file_name + "\""));
+
+          shared_window_.clear();
+          buffer_.resize_fast(size);
+          read_file(file_name, buffer_.data(), size);
+          begin = buffer_.data();
+        }
+
+        const char *end = begin + size;
+
+        std::array<char, 8> file_signature;
+        std::uint32_t file_version;
+        const auto header_size = LogSpacedTable::aligned_size(
+            file_signature.size() + sizeof(version));
+        AssertThrow(size >= header_size,
+                    dealii::ExcMessage("The file \"" + file_name +
+                                       "\" is not a valid table file"));
+        std::memcpy(file_signature.data(), begin, file_signature.size());
+        std::memcpy(&file_version,
+                    begin + file_signature.size(),
+                    sizeof(file_version));
+        AssertThrow(file_signature == signature && file_version == version,
+                    dealii::ExcMessage("The file \"" + file_name +
+                                       "\" is not a valid table file"));
+
+        begin = p_rho_e_.attach(begin + header_size, end);
+        begin = e_rho_p_.attach(begin, end);
+        begin = c_rho_e_.attach(begin, end);
+      }
+
+      /**
+       * Write the tables in binary format to the file @p file_name.
+       */
+      void write(const std::string &file_name) const
+      {
+        std::ofstream output(file_name, std::ios::binary);
+        output.write(signature.data(), signature.size());
+        output.write(reinterpret_cast<const char *>(&version),
+                     sizeof(version));
+        LogSpacedTable::write_padding(output,
+                                      signature.size() + sizeof(version));
+
+        p_rho_e_.write(output);
+        e_rho_p_.write(output);
+        c_rho_e_.write(output);
+        AssertThrow(output,
+                    dealii::ExcMessage("Could not write table file \"" +
+                                       file_name + "\""));
+      }
+
+      /**
+       * Write access to the tables, used for populating tables
+       * programmatically.
+       */
+      //@{
+      ACCESSOR(p_rho_e)
+      ACCESSOR(e_rho_p)
+      ACCESSOR(c_rho_e)
+      //@}
+
+    private:
+      /**
+       * Return the size of the file @p file_name in bytes, or 0 if the
+       * file cannot be opened.
+       */
+      static std::uint64_t file_size(const std::string &file_name)
+      {
+        std::ifstream input(file_name, std::ios::binary | std::ios::ate);
+        if (!input)
+          return 0;
+        return input.tellg();
+      }
+
+      /**
+       * Read @p size bytes of the file @p file_name into @p destination.
+       */
+      static void read_file(const std::string &file_name,
+                            char *destination,
+                            const std::uint64_t size)
+      {
+        std::ifstream input(file_name, std::ios::binary);
+        input.read(destination, size);
+        AssertThrow(input,
+                    dealii::ExcMessage("Could not read table file \"" +
+                                       file_name + "\""));
+      }
+
+      const MPI_Comm mpi_communicator_;
+
+      std::string table_file_;
+      bool node_shared_tables_;
+
+      LogSpacedTable p_rho_e_;
+      LogSpacedTable e_rho_p_;
+      LogSpacedTable c_rho_e_;
+
+      /* Cache-line aligned storage for tables read from a file: */
+      dealii::AlignedVector<char> buffer_;
+      SharedMemoryWindow shared_window_;
+    };
+  } // namespace EquationOfStateLibrary
+} // namespace ryujin
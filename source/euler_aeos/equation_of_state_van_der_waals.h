@@ -7,6 +7,8 @@
 
 #include "equation_of_state.h"
 
+#include <simd.h>
+
 namespace ryujin
 {
   namespace EquationOfStateLibrary
@@ -59,12 +61,21 @@ namespace ryujin
        *   p = (\gamma - 1) * (\rho * e + a \rho^2)/(1 - b \rho) - a \rho^2
        * \f}
        */
-      double pressure(double rho, double e) const final
+      template <typename Number>
+      DEAL_II_ALWAYS_INLINE inline Number pressure(const Number &rho,
+                                                   const Number &e) const
       {
-        const auto intermolecular = a_ * rho * rho;
+        using ScalarNumber = typename get_value_type<Number>::type;
+        const auto intermolecular = ScalarNumber(a_) * rho * rho;
         const auto numerator = rho * e + intermolecular;
-        const auto covolume = 1. - b_ * rho;
-        return (gamma_ - 1.) * numerator / covolume - intermolecular;
+        const auto covolume = ScalarNumber(1.) - ScalarNumber(b_) * rho;
+        return ScalarNumber(gamma_ - 1.) * numerator / covolume -
+               intermolecular;
+      }
+
+      double pressure(double rho, double e) const final
+      {
+        return pressure<double>(rho, e);
       }
 
       /**
@@ -74,13 +85,21 @@ namespace ryujin
        *   - a \rho^2
        * \f}
        */
-      double specific_internal_energy(double rho, double p) const final
+      template <typename Number>
+      DEAL_II_ALWAYS_INLINE inline Number
+      specific_internal_energy(const Number &rho, const Number &p) const
       {
-        const auto intermolecular = a_ * rho * rho;
-        const auto covolume = 1. - b_ * rho;
+        using ScalarNumber = typename get_value_type<Number>::type;
+        const auto intermolecular = ScalarNumber(a_) * rho * rho;
+        const auto covolume = ScalarNumber(1.) - ScalarNumber(b_) * rho;
         const auto numerator = (p + intermolecular) * covolume;
-        const auto denominator = rho * (gamma_ - 1.);
-        return numerator / denominator - a_ * rho;
+        const auto denominator = rho * ScalarNumber(gamma_ - 1.);
+        return numerator / denominator - ScalarNumber(a_) * rho;
+      }
+
+      double specific_internal_energy(double rho, double p) const final
+      {
+        return specific_internal_energy<double>(rho, p);
       }
 
       /**
@@ -89,9 +108,17 @@ namespace ryujin
        *   T = (\gamma - 1) / R (e + a \rho)
        * \f}
        */
+      template <typename Number>
+      DEAL_II_ALWAYS_INLINE inline Number temperature(const Number &rho,
+                                                      const Number &e) const
+      {
+        using ScalarNumber = typename get_value_type<Number>::type;
+        return (e + ScalarNumber(a_) * rho) / ScalarNumber(cv_);
+      }
+
       double temperature(double rho, double e) const final
       {
-        return (e + a_ * rho) / cv_;
+        return temperature<double>(rho, e);
       }
 
       /**
@@ -101,11 +128,21 @@ namespace ryujin
        *   - 2a\rho.
        * \f}
        */
+      template <typename Number>
+      DEAL_II_ALWAYS_INLINE inline Number speed_of_sound(const Number &rho,
+                                                         const Number &e) const
+      {
+        using ScalarNumber = typename get_value_type<Number>::type;
+        const auto covolume = ScalarNumber(1.) - ScalarNumber(b_) * rho;
+        const auto numerator = ScalarNumber(gamma_ * (gamma_ - 1.)) *
+                               (e + ScalarNumber(a_) * rho);
+        return std::sqrt(numerator / (covolume * covolume) -
+                         ScalarNumber(2. * a_) * rho);
+      }
+
       double speed_of_sound(double rho, double e) const final
       {
-        const auto covolume = 1. - b_ * rho;
-        const auto numerator = gamma_ * (gamma_ - 1.) * (e + a_ * rho);
-        return std::sqrt(numerator / (covolume * covolume) - 2. * a_ * rho);
+        return speed_of_sound<double>(rho, e);
       }
 
     private:
@@ -5,7 +5,12 @@
 
 #pragma once
 
+#include "equation_of_state_jones_wilkins_lee.h"
 #include "equation_of_state_library.h"
+#include "equation_of_state_noble_abel_stiffened_gas.h"
+#include "equation_of_state_polytropic_gas.h"
+#include "equation_of_state_tabulated.h"
+#include "equation_of_state_van_der_waals.h"
 
 #include <compile_time_options.h>
 #include <convenience_macros.h>
@@ -49,9 +54,11 @@ namespace ryujin
           "Compressible Euler equations (arbitrary EOS)";
 
       /**
-       * Constructor.
+       * Constructor. The MPI communicator @p mpi_communicator is used by
+       * equations of state that read tables collectively.
        */
-      HyperbolicSystem(const std::string &subsection = "/HyperbolicSystem");
+      HyperbolicSystem(const std::string &subsection = "/HyperbolicSystem",
+                       const MPI_Comm &mpi_communicator = MPI_COMM_WORLD);
 
       /**
        * Return a view on the Hyperbolic System for a given dimension @p
@@ -83,6 +90,22 @@ namespace ryujin
       using EquationOfState = EquationOfStateLibrary::EquationOfState;
       std::shared_ptr<EquationOfState> selected_equation_of_state_;
 
+      /**
+       * The concrete type of the selected equation of state if it is one
+       * of the models with a vectorized (function template) interface,
+       * and generic otherwise. See
+       * HyperbolicSystemView::dispatch_equation_of_state().
+       */
+      enum class EquationOfStateType {
+        generic,
+        jones_wilkins_lee,
+        noble_abel_stiffened_gas,
+        polytropic_gas,
+        tabulated,
+        van_der_waals,
+      };
+      EquationOfStateType equation_of_state_type_;
+
       template <int dim, typename Number>
       friend class HyperbolicSystemView;
       //@}
@@ -170,6 +193,49 @@ namespace ryujin
        */
       //@{
 
+      /**
+       * Call @p payload with a reference to the selected equation of
+       * state. For the analytic equations of state (polytropic gas,
+       * Noble-Abel-stiffened gas, van der Waals, and Jones-Wilkins-Lee)
+       * and the tabulated equation of state the argument is a reference
+       * to the concrete type, which makes the (vectorized) function
+       * templates of the equation of state available and allows the
+       * compiler to inline them. For all other equations of state the
+       * argument is a reference to the abstract
+       * EquationOfStateLibrary::EquationOfState base class.
+       *
+       * Intended usage is to hoist the dispatch out of a loop:
+       * ```
+       * view.dispatch_equation_of_state([&](const auto &eos) {
+       *   for (...)
+       *     const auto p_i = view.eos_pressure(eos, rho_i, e_i);
+       * });
+       * ```
+       */
+      template <typename PAYLOAD>
+      DEAL_II_ALWAYS_INLINE inline decltype(auto)
+      dispatch_equation_of_state(const PAYLOAD &payload) const
+      {
+        using namespace EquationOfStateLibrary;
+        using EOST = HyperbolicSystem::EquationOfStateType;
+        const auto &eos = *hyperbolic_system_.selected_equation_of_state_;
+
+        switch (hyperbolic_system_.equation_of_state_type_) {
+        case EOST::jones_wilkins_lee:
+          return payload(static_cast<const JonesWilkinsLee &>(eos));
+        case EOST::noble_abel_stiffened_gas:
+          return payload(static_cast<const NobleAbelStiffenedGas &>(eos));
+        case EOST::polytropic_gas:
+          return payload(static_cast<const PolytropicGas &>(eos));
+        case EOST::tabulated:
+          return payload(static_cast<const Tabulated &>(eos));
+        case EOST::van_der_waals:
+          return payload(static_cast<const VanDerWaals &>(eos));
+        default:
+          return payload(eos);
+        }
+      }
+
       /**
        * For a given density \f$\rho\f$ and <i>specific</i> internal
        * energy \f$e\f$ return the pressure \f$p\f$.
@@ -177,17 +243,21 @@ namespace ryujin
       DEAL_II_ALWAYS_INLINE inline Number eos_pressure(const Number &rho,
                                                        const Number &e) const
       {
-        const auto &eos = hyperbolic_system_.selected_equation_of_state_;
+        return dispatch_equation_of_state(
+            [&](const auto &eos) { return eos_pressure(eos, rho, e); });
+      }
 
-        if constexpr (std::is_same_v<ScalarNumber, Number>) {
-          return ScalarNumber(eos->pressure(rho, e));
-        } else {
-          Number p;
-          for (unsigned int k = 0; k < Number::size(); ++k) {
-            p[k] = ScalarNumber(eos->pressure(rho[k], e[k]));
-          }
-          return p;
-        }
+      /**
+       * Variant of above function for a given equation of state @p eos as
+       * supplied by dispatch_equation_of_state().
+       */
+      template <typename EOS>
+      DEAL_II_ALWAYS_INLINE inline static Number
+      eos_pressure(const EOS &eos, const Number &rho, const Number &e)
+      {
+        return evaluate_eos<EOS>(rho, e, [&](const auto &x, const auto &y) {
+          return eos.pressure(x, y);
+        });
       }
 
       /**
@@ -197,17 +267,22 @@ namespace ryujin
       DEAL_II_ALWAYS_INLINE inline Number
       eos_specific_internal_energy(const Number &rho, const Number &p) const
       {
-        const auto &eos = hyperbolic_system_.selected_equation_of_state_;
+        return dispatch_equation_of_state([&](const auto &eos) {
+          return eos_specific_internal_energy(eos, rho, p);
+        });
+      }
 
-        if constexpr (std::is_same_v<ScalarNumber, Number>) {
-          return ScalarNumber(eos->specific_internal_energy(rho, p));
-        } else {
-          Number e;
-          for (unsigned int k = 0; k < Number::size(); ++k) {
-            e[k] = ScalarNumber(eos->specific_internal_energy(rho[k], p[k]));
-          }
-          return e;
-        }
+      /**
+       * Variant of above function for a given equation of state @p eos as
+       * supplied by dispatch_equation_of_state().
+       */
+      template <typename EOS>
+      DEAL_II_ALWAYS_INLINE inline static Number eos_specific_internal_energy(
+          const EOS &eos, const Number &rho, const Number &p)
+      {
+        return evaluate_eos<EOS>(rho, p, [&](const auto &x, const auto &y) {
+          return eos.specific_internal_energy(x, y);
+        });
       }
 
       /**
@@ -217,17 +292,21 @@ namespace ryujin
       DEAL_II_ALWAYS_INLINE inline Number eos_temperature(const Number &rho,
                                                           const Number &e) const
       {
-        const auto &eos = hyperbolic_system_.selected_equation_of_state_;
+        return dispatch_equation_of_state(
+            [&](const auto &eos) { return eos_temperature(eos, rho, e); });
+      }
 
-        if constexpr (std::is_same_v<ScalarNumber, Number>) {
-          return ScalarNumber(eos->temperature(rho, e));
-        } else {
-          Number temp;
-          for (unsigned int k = 0; k < Number::size(); ++k) {
-            temp[k] = ScalarNumber(eos->temperature(rho[k], e[k]));
-          }
-          return temp;
-        }
+      /**
+       * Variant of above function for a given equation of state @p eos as
+       * supplied by dispatch_equation_of_state().
+       */
+      template <typename EOS>
+      DEAL_II_ALWAYS_INLINE inline static Number
+      eos_temperature(const EOS &eos, const Number &rho, const Number &e)
+      {
+        return evaluate_eos<EOS>(rho, e, [&](const auto &x, const auto &y) {
+          return eos.temperature(x, y);
+        });
       }
 
       /**
@@ -237,17 +316,21 @@ namespace ryujin
       DEAL_II_ALWAYS_INLINE inline Number
       eos_speed_of_sound(const Number &rho, const Number &e) const
       {
-        const auto &eos = hyperbolic_system_.selected_equation_of_state_;
+        return dispatch_equation_of_state(
+            [&](const auto &eos) { return eos_speed_of_sound(eos, rho, e); });
+      }
 
-        if constexpr (std::is_same_v<ScalarNumber, Number>) {
-          return ScalarNumber(eos->speed_of_sound(rho, e));
-        } else {
-          Number c;
-          for (unsigned int k = 0; k < Number::size(); ++k) {
-            c[k] = ScalarNumber(eos->speed_of_sound(rho[k], e[k]));
-          }
-          return c;
-        }
+      /**
+       * Variant of above function for a given equation of state @p eos as
+       * supplied by dispatch_equation_of_state().
+       */
+      template <typename EOS>
+      DEAL_II_ALWAYS_INLINE inline static Number
+      eos_speed_of_sound(const EOS &eos, const Number &rho, const Number &e)
+      {
+        return evaluate_eos<EOS>(rho, e, [&](const auto &x, const auto &y) {
+          return eos.speed_of_sound(x, y);
+        });
       }
 
       /**
@@ -278,6 +361,34 @@ namespace ryujin
     private:
       const HyperbolicSystem &hyperbolic_system_;
 
+      /**
+       * Evaluate @p function for the arguments @p a and @p b. If the
+       * equation of state @p EOS is one of the analytic models, or the
+       * tabulated equation of state, the function is called directly with
+       * (scalar or vectorized) Number arguments. Otherwise, it is called
+       * with double arguments once for every SIMD lane, which makes one
+       * virtual function call per lane.
+       */
+      template <typename EOS, typename FUNCTION>
+      DEAL_II_ALWAYS_INLINE inline static Number evaluate_eos(
+          const Number &a, const Number &b, const FUNCTION &function)
+      {
+        constexpr bool is_generic =
+            std::is_same_v<EOS, EquationOfStateLibrary::EquationOfState>;
+
+        if constexpr (std::is_same_v<ScalarNumber, Number>) {
+          return ScalarNumber(function(double(a), double(b)));
+        } else if constexpr (!is_generic) {
+          return function(a, b);
+        } else {
+          Number result;
+          for (unsigned int k = 0; k < Number::size(); ++k) {
+            result[k] = ScalarNumber(function(double(a[k]), double(b[k])));
+          }
+          return result;
+        }
+      }
+
     public:
       //@}
       /**
@@ -741,7 +852,8 @@ namespace ryujin
 
 
     inline HyperbolicSystem::HyperbolicSystem(
-        const std::string &subsection /*= "HyperbolicSystem"*/)
+        const std::string &subsection /*= "HyperbolicSystem"*/,
+        const MPI_Comm &mpi_communicator /*= MPI_COMM_WORLD*/)
         : ParameterAcceptor(subsection)
     {
       equation_of_state_ = "polytropic gas";
@@ -782,7 +894,7 @@ namespace ryujin
        * state configurations defined in the EquationOfState namespace:
        */
       EquationOfStateLibrary::populate_equation_of_state_list(
-          equation_of_state_list_, subsection);
+          equation_of_state_list_, subsection, mpi_communicator);
 
       const auto populate_functions = [this]() {
         bool initialized = false;
@@ -791,6 +903,22 @@ namespace ryujin
           /* Populate EOS-specific quantities and functions */
           if (it->name() == equation_of_state_) {
             selected_equation_of_state_ = it;
+
+            using namespace EquationOfStateLibrary;
+            using EOST = EquationOfStateType;
+            const auto eos = it.get();
+            equation_of_state_type_ = EOST::generic;
+            if (dynamic_cast<const JonesWilkinsLee *>(eos))
+              equation_of_state_type_ = EOST::jones_wilkins_lee;
+            else if (dynamic_cast<const NobleAbelStiffenedGas *>(eos))
+              equation_of_state_type_ = EOST::noble_abel_stiffened_gas;
+            else if (dynamic_cast<const PolytropicGas *>(eos))
+              equation_of_state_type_ = EOST::polytropic_gas;
+            else if (dynamic_cast<const Tabulated *>(eos))
+              equation_of_state_type_ = EOST::tabulated;
+            else if (dynamic_cast<const VanDerWaals *>(eos))
+              equation_of_state_type_ = EOST::van_der_waals;
+
             problem_name =
                 "Compressible Euler equations (" + it->name() + " EOS)";
             initialized = true;
@@ -833,23 +961,42 @@ namespace ryujin
       if (cycle == 0) {
         if (eos->prefer_vector_interface()) {
           /*
-           * Set up temporary storage for p, rho, e and make two calls into
-           * the eos library.
+           * Split the index range [left, right) into contiguous chunks
+           * (aligned to the stride size), one per thread. Every thread
+           * gathers rho and e of its chunk into thread-local scratch
+           * vectors and makes a single call into the eos library.
+           *
+           * We distribute the strides the way libgomp implements a
+           * statically scheduled RYUJIN_OMP_FOR loop: every thread
+           * receives n_strides / n_threads strides and the first
+           * n_strides % n_threads threads receive one additional stride.
+           * This keeps the chunks on the threads that first touched the
+           * corresponding vector entries.
            */
-          const auto offset = left;
-          const auto size = right - left;
-
-          static /* shared */ std::vector<double> p;
-          static /* shared */ std::vector<double> rho;
-          static /* shared */ std::vector<double> e;
-          RYUJIN_OMP_SINGLE
-          {
-            p.resize(size);
-            rho.resize(size);
-            e.resize(size);
-          }
+#ifdef WITH_OPENMP
+          const unsigned int n_threads = omp_get_num_threads();
+          const unsigned int thread = omp_get_thread_num();
+#else
+          const unsigned int n_threads = 1;
+          const unsigned int thread = 0;
+#endif
+          const unsigned int n_strides = (right - left) / stride_size;
+          const unsigned int chunk = n_strides / n_threads;
+          const unsigned int remainder = n_strides % n_threads;
+          const unsigned int begin =
+              thread * chunk + std::min(thread, remainder);
+          const unsigned int end = begin + chunk + (thread < remainder);
+
+          const auto offset = left + begin * stride_size;
+          const auto size = (end - begin) * stride_size;
+
+          thread_local static std::vector<double> p;
+          thread_local static std::vector<double> rho;
+          thread_local static std::vector<double> e;
+          p.resize(size);
+          rho.resize(size);
+          e.resize(size);
 
-          RYUJIN_OMP_FOR
           for (unsigned int i = 0; i < size; i += stride_size) {
             const auto U_i = U.template get_tensor<Number>(offset + i);
             const auto rho_i = density(U_i);
@@ -863,20 +1010,17 @@ namespace ryujin
             write_entry<Number>(e, e_i, i);
           }
 
-          /* Make sure the call into eospac (and others) is single threaded. */
-          RYUJIN_OMP_SINGLE
-          {
+          if (size != 0)
             eos->pressure(p, rho, e);
-          }
 
-          RYUJIN_OMP_FOR
           for (unsigned int i = 0; i < size; i += stride_size) {
             /* Skip constrained degrees of freedom: */
-            const unsigned int row_length = sparsity_simd.row_length(i);
+            const unsigned int row_length =
+                sparsity_simd.row_length(offset + i);
             if (row_length == 1)
               continue;
 
-            dispatch_check(i);
+            dispatch_check(offset + i);
 
             using PT = precomputed_type;
             const auto U_i = U.template get_tensor<Number>(offset + i);
@@ -890,26 +1034,32 @@ namespace ryujin
            * This is the variant with slightly better performance provided
            * that a call to the eos is not too expensive. This variant
            * calls into the eos library for every single degree of freedom.
+           *
+           * We dispatch on the type of the equation of state outside of
+           * the loop so that the (vectorized) pressure evaluation of
+           * analytic and tabulated equations of state gets inlined.
            */
-          RYUJIN_OMP_FOR
-          for (unsigned int i = left; i < right; i += stride_size) {
-            /* Skip constrained degrees of freedom: */
-            const unsigned int row_length = sparsity_simd.row_length(i);
-            if (row_length == 1)
-              continue;
-
-            dispatch_check(i);
-
-            const auto U_i = U.template get_tensor<Number>(i);
-            const auto rho_i = density(U_i);
-            const auto e_i = internal_energy(U_i) / rho_i;
-            const auto p_i = eos_pressure(rho_i, e_i);
-
-            const auto gamma_i = surrogate_gamma(U_i, p_i);
-            using PT = precomputed_type;
-            const PT prec_i{p_i, gamma_i, Number(0.), Number(0.)};
-            precomputed.template write_tensor<Number>(prec_i, i);
-          }
+          dispatch_equation_of_state([&](const auto &selected_eos) {
+            RYUJIN_OMP_FOR
+            for (unsigned int i = left; i < right; i += stride_size) {
+              /* Skip constrained degrees of freedom: */
+              const unsigned int row_length = sparsity_simd.row_length(i);
+              if (row_length == 1)
+                continue;
+
+              dispatch_check(i);
+
+              const auto U_i = U.template get_tensor<Number>(i);
+              const auto rho_i = density(U_i);
+              const auto e_i = internal_energy(U_i) / rho_i;
+              const auto p_i = eos_pressure(selected_eos, rho_i, e_i);
+
+              const auto gamma_i = surrogate_gamma(U_i, p_i);
+              using PT = precomputed_type;
+              const PT prec_i{p_i, gamma_i, Number(0.), Number(0.)};
+              precomputed.template write_tensor<Number>(prec_i, i);
+            }
+          });
         } /* prefer_vector_interface */
       }   /* cycle == 0 */
 
@@ -221,6 +221,26 @@ namespace ryujin
                 StateVector &new_state_vector,
                 Number tau = Number(0.)) const;
 
+    /**
+     * Signal the beginning of a new time step. The next call to step()
+     * is treated as the first stage of this time step. If @p restart is
+     * set to true, the time step is a repetition of the previous (failed)
+     * time step starting from the identical old state.
+     *
+     * If the "reuse on restart" run time option is set, the first stage
+     * of a restarted time step reuses d_ij, alpha_i, the maximal time
+     * step size (rescaled to the current CFL number), and, if they do not
+     * depend on tau, the limiter bounds that have been computed for the
+     * first stage of the failed attempt. All subsequent stages use a
+     * separate set of temporary storage so that the first-stage data
+     * remains intact.
+     */
+    void begin_time_step(const bool restart) const
+    {
+      first_stage_ = true;
+      restart_ = restart;
+    }
+
     /**
      * Sets the relative CFL number used for computing an appropriate
      * time-step size to the given value. The CFL number must be a positive
@@ -258,7 +278,8 @@ namespace ryujin
     /**
      * Return a reference to alpha vector storing indicator values. Note
      * that the values stored in alpha correspond to the last step executed
-     * by this class.
+     * by this class (or to the first stage of the last time step if the
+     * "reuse on restart" option is set).
      */
     ACCESSOR_READ_ONLY(alpha)
 
@@ -291,6 +312,12 @@ namespace ryujin
     typename Description::template RiemannSolver<dim, Number>::Parameters
         riemann_solver_parameters_;
 
+    bool recompute_dij_;
+
+    bool reuse_on_restart_;
+
+    bool mirror_transposed_lij_;
+
     //@}
 
     //@}
@@ -313,6 +340,12 @@ namespace ryujin
 
     mutable unsigned int n_warnings_;
 
+    mutable bool first_stage_;
+    mutable bool restart_;
+    mutable bool first_stage_valid_;
+    mutable Number first_stage_tau_max_;
+    mutable Number first_stage_cfl_;
+
     InitialPrecomputedVector initial_precomputed_;
 
     using ScalarVector = typename Vectors::ScalarVector<Number>;
@@ -322,14 +355,46 @@ namespace ryujin
         Description::template Limiter<dim, Number>::n_bounds;
     mutable Vectors::MultiComponentVector<Number, n_bounds> bounds_;
 
+    /* Temporary storage for all but the first stage of a time step: */
+    mutable ScalarVector alpha_swap_;
+    mutable Vectors::MultiComponentVector<Number, n_bounds> bounds_swap_;
+
     using HyperbolicVector =
         Vectors::MultiComponentVector<Number, problem_dimension>;
     mutable HyperbolicVector r_;
 
-    mutable SparseMatrixSIMD<Number> dij_matrix_;
-    mutable SparseMatrixSIMD<Number> lij_matrix_;
-    mutable SparseMatrixSIMD<Number> lij_matrix_next_;
-    mutable SparseMatrixSIMD<Number, problem_dimension> pij_matrix_;
+    /*
+     * The auxiliary matrices l_ij and p_ij are optionally stored in
+     * single precision (see the MIXED_PRECISION compile-time option). All
+     * accumulations are still performed in Number.
+     *
+     * The d_ij matrix is always stored in Number: narrowing d_ij with
+     * round-to-nearest could produce a value below the computed upper
+     * bound on the maximal wave speed, which would void the invariant
+     * domain property of the low-order update.
+     */
+#ifdef MIXED_PRECISION
+    using AuxiliaryNumber = float;
+#else
+    using AuxiliaryNumber = Number;
+#endif
+
+    template <int n_components = 1>
+    using AuxiliaryMatrix =
+        SparseMatrixSIMD<AuxiliaryNumber,
+                         n_components,
+                         dealii::VectorizedArray<Number>::size()>;
+
+    using DijMatrix =
+        SparseMatrixSIMD<Number, 1, dealii::VectorizedArray<Number>::size()>;
+
+    mutable DijMatrix dij_matrix_;
+    mutable DijMatrix dij_matrix_swap_;
+    mutable ScalarVector dii_;
+    mutable std::vector<Number> dij_coupling_;
+    mutable AuxiliaryMatrix<> lij_matrix_;
+    mutable AuxiliaryMatrix<> lij_matrix_next_;
+    mutable AuxiliaryMatrix<problem_dimension> pij_matrix_;
 
     //@}
   };
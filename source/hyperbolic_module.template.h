@@ -45,7 +45,42 @@ namespace ryujin
       , cfl_(0.2)
       , n_restarts_(0)
       , n_warnings_(0)
+      , first_stage_(false)
+      , restart_(false)
+      , first_stage_valid_(false)
   {
+    recompute_dij_ = false;
+    add_parameter(
+        "recompute dij",
+        recompute_dij_,
+        "If set to true the graph viscosity d_ij is not stored in a sparse "
+        "matrix but recomputed on the fly in every row sweep. Only the "
+        "diagonal d_ii and the d_ij of coupling boundary pairs are stored. "
+        "This trades additional Riemann solver invocations (two per matrix "
+        "entry instead of one per edge, i.e., about four times as many) for "
+        "a substantially reduced memory footprint and bandwidth. Use "
+        "scripts/compare_recompute_dij to compare the run time of both "
+        "variants for a given configuration.");
+
+    reuse_on_restart_ = false;
+    add_parameter(
+        "reuse on restart",
+        reuse_on_restart_,
+        "If set to true the graph viscosity d_ij, the indicator alpha_i, "
+        "and (if independent of tau) the limiter bounds of the first stage "
+        "of a time step are kept and reused when the time step has to be "
+        "restarted with a reduced CFL number. This requires an additional "
+        "set of temporary storage.");
+
+    mirror_transposed_lij_ = false;
+    add_parameter(
+        "mirror transposed lij",
+        mirror_transposed_lij_,
+        "If set to true the limiter matrix l_ij additionally maintains a "
+        "transpose-mirrored copy that is updated with a scatter whenever "
+        "l_ij is written. The symmetrization min(l_ij, l_ji) then uses "
+        "contiguous vector loads instead of a gather at the cost of an "
+        "additional matrix worth of memory.");
   }
 
 
@@ -63,10 +98,27 @@ namespace ryujin
 
     /* Initialize vectors: */
 
+    AssertThrow(!(reuse_on_restart_ && recompute_dij_),
+                dealii::ExcMessage("The \"reuse on restart\" option "
+                                   "requires a stored d_ij matrix and cannot "
+                                   "be combined with \"recompute dij\"."));
+
     const auto &scalar_partitioner = offline_data_->scalar_partitioner();
     alpha_.reinit(scalar_partitioner);
     bounds_.reinit_with_scalar_partitioner(scalar_partitioner);
 
+    first_stage_ = false;
+    restart_ = false;
+    first_stage_valid_ = false;
+
+    if (reuse_on_restart_) {
+      alpha_swap_.reinit(scalar_partitioner);
+      bounds_swap_.reinit_with_scalar_partitioner(scalar_partitioner);
+    } else {
+      alpha_swap_.reinit(0);
+      bounds_swap_.reinit(0);
+    }
+
     r_.reinit(offline_data_->hyperbolic_vector_partitioner());
     using View =
         typename Description::template HyperbolicSystemView<dim, Number>;
@@ -74,9 +126,22 @@ namespace ryujin
     /* Initialize matrices: */
 
     const auto &sparsity_simd = offline_data_->sparsity_pattern_simd();
-    dij_matrix_.reinit(sparsity_simd);
-    lij_matrix_.reinit(sparsity_simd);
-    lij_matrix_next_.reinit(sparsity_simd);
+    if (recompute_dij_) {
+      /* Only store the diagonal and values for coupling boundary pairs: */
+      dij_matrix_ = DijMatrix();
+      dii_.reinit(scalar_partitioner);
+      dij_coupling_.resize(offline_data_->coupling_boundary_pairs().size());
+    } else {
+      dij_matrix_.reinit(sparsity_simd);
+      dii_.reinit(0);
+      dij_coupling_.clear();
+    }
+    if (reuse_on_restart_)
+      dij_matrix_swap_.reinit(sparsity_simd);
+    else
+      dij_matrix_swap_ = DijMatrix();
+    lij_matrix_.reinit(sparsity_simd, mirror_transposed_lij_);
+    lij_matrix_next_.reinit(sparsity_simd, mirror_transposed_lij_);
     pij_matrix_.reinit(sparsity_simd);
 
     /* Set up initial precomputed vector: */
@@ -110,7 +175,7 @@ namespace ryujin
     const unsigned int n_internal = offline_data_->n_locally_internal();
     const unsigned int n_owned = offline_data_->n_locally_owned();
     const auto &sparsity_simd = offline_data_->sparsity_pattern_simd();
-    const auto &boundary_map = offline_data_->boundary_map();
+    const auto &boundary_map_soa = offline_data_->boundary_map_soa();
     unsigned int channel = 10;
     using VA = VectorizedArray<Number>;
 
@@ -119,28 +184,50 @@ namespace ryujin
 
     LIKWID_MARKER_START("time_step_1a");
 
-    /* FIXME: not thread parallel... */
-    for (const auto &entry : boundary_map) {
-      const auto &[i, normal, normal_mass, boundary_mass, id, position] = entry;
+    /*
+     * Evaluate the Dirichlet boundary data for all entries of the boundary
+     * map up front (thread parallel). The loops below only read from the
+     * resulting per-entry slots:
+     */
+    initial_values_->update_boundary_data(t);
 
-      /*
-       * Relay the task of applying appropriate boundary conditions to the
-       * Problem Description.
-       */
+    /*
+     * The boundary map is stored as a structure of arrays that is split
+     * into layers of entries that can be processed in parallel (every
+     * degree of freedom occurs at most once per layer):
+     */
 
-      if (id == Boundary::do_nothing)
-        continue;
+    const auto &layer_starts = boundary_map_soa.layer_starts;
 
-      auto U_i = U.get_tensor(i);
+    for (unsigned int layer = 0; layer + 1 < layer_starts.size(); ++layer) {
 
-      /* Use a lambda to avoid computing unnecessary state values */
-      auto get_dirichlet_data = [position = position, t = t, this]() {
-        return initial_values_->initial_state(position, t);
-      };
+      RYUJIN_PARALLEL_REGION_BEGIN
 
       const auto view = hyperbolic_system_->template view<dim, Number>();
-      U_i = view.apply_boundary_conditions(id, U_i, normal, get_dirichlet_data);
-      U.write_tensor(U_i, i);
+
+      RYUJIN_OMP_FOR
+      for (unsigned int k = layer_starts[layer]; k < layer_starts[layer + 1];
+           ++k) {
+        const auto i = boundary_map_soa.i[k];
+        const auto id = boundary_map_soa.id[k];
+
+        /*
+         * Relay the task of applying appropriate boundary conditions to
+         * the Problem Description.
+         */
+
+        auto U_i = U.get_tensor(i);
+
+        auto get_dirichlet_data = [&, k = k]() {
+          return initial_values_->boundary_state(k);
+        };
+
+        U_i = view.apply_boundary_conditions(
+            id, U_i, boundary_map_soa.normal[k], get_dirichlet_data);
+        U.write_tensor(U_i, i);
+      }
+
+      RYUJIN_PARALLEL_REGION_END
     }
 
     LIKWID_MARKER_STOP("time_step_1a");
@@ -203,29 +290,59 @@ namespace ryujin
   namespace
   {
     /**
-     * Internally used: returns true if all indices are on the lower
-     * triangular part of the matrix.
+     * Internally used: write the value @p entry of an edge batch to the
+     * (i,j) and the transposed (j,i) entry of @p matrix. Only lanes that
+     * are set in @p lane_mask are written.
      */
-    template <typename T>
-    bool all_below_diagonal(unsigned int i, const unsigned int *js)
+    template <typename T, typename Matrix>
+    void write_edge(Matrix &matrix,
+                    const T &entry,
+                    const unsigned int i,
+                    const unsigned int col_idx,
+                    const unsigned int lane_mask)
     {
       if constexpr (std::is_same_v<T, typename get_value_type<T>::type>) {
         /* Non-vectorized sequential access. */
-        const auto j = *js;
-        return j < i;
+        Assert(lane_mask == 1u, dealii::ExcInternalError());
+        matrix.write_entry(entry, i, col_idx);
+        matrix.write_transposed_entry(entry, i, col_idx);
 
       } else {
-        /* Vectorized fast access. index must be divisible by simd_length */
+        constexpr unsigned int simd_length = T::size();
+
+        if (lane_mask == (1u << simd_length) - 1u) {
+          /* Vectorized fast access for a full edge batch. */
+          matrix.write_entry(entry, i, col_idx);
+          matrix.write_transposed_entry(entry, i, col_idx);
+
+        } else {
+          /* Masked access lane by lane. */
+          using Number = typename get_value_type<T>::type;
+          for (unsigned int k = 0; k < simd_length; ++k)
+            if (lane_mask & (1u << k)) {
+              matrix.template write_entry<Number>(entry[k], i + k, col_idx);
+              matrix.template write_transposed_entry<Number>(
+                  entry[k], i + k, col_idx);
+            }
+        }
+      }
+    }
 
-        constexpr auto simd_length = T::size();
 
-        bool all_below_diagonal = true;
-        for (unsigned int k = 0; k < simd_length; ++k)
-          if (js[k] >= i + k) {
-            all_below_diagonal = false;
-            break;
-          }
-        return all_below_diagonal;
+    /**
+     * Internally used: set the lane @p k of a (possibly vectorized)
+     * entry @p entry to the given scalar @p value.
+     */
+    template <typename T>
+    void write_lane(T &entry,
+                    const unsigned int k,
+                    const typename get_value_type<T>::type value)
+    {
+      if constexpr (std::is_same_v<T, typename get_value_type<T>::type>) {
+        Assert(k == 0, dealii::ExcInternalError());
+        entry = value;
+      } else {
+        entry[k] = value;
       }
     }
   } // namespace
@@ -273,7 +390,7 @@ namespace ryujin
 
     /* Index ranges for the iteration over the sparsity pattern : */
 
-    constexpr auto simd_length = VA::size();
+    [[maybe_unused]] constexpr auto simd_length = VA::size();
     const unsigned int n_export_indices = offline_data_->n_export_indices();
     const unsigned int n_internal = offline_data_->n_locally_internal();
     const unsigned int n_owned = offline_data_->n_locally_owned();
@@ -281,6 +398,7 @@ namespace ryujin
     /* References to precomputed matrices and the stencil: */
 
     const auto &sparsity_simd = offline_data_->sparsity_pattern_simd();
+    const auto &edge_list = offline_data_->edge_list_simd();
 
     const auto &mass_matrix = offline_data_->mass_matrix();
     const auto &mass_matrix_inverse = offline_data_->mass_matrix_inverse();
@@ -311,6 +429,92 @@ namespace ryujin
     /* A boolean signalling that a restart is necessary: */
     std::atomic<bool> restart_needed = false;
 
+    /*
+     * Restart-aware stepping (see begin_time_step()): The first stage of a
+     * time step keeps d_ij, alpha_i, the limiter bounds, and tau_max in
+     * the primary storage, all subsequent stages swap in a separate set
+     * of storage. If the time step is restarted, the first stage reuses
+     * all data that does not depend on tau.
+     */
+
+    const bool first_stage = first_stage_;
+    first_stage_ = false;
+
+    const bool reuse_first_stage =
+        reuse_on_restart_ && first_stage && restart_ && first_stage_valid_;
+
+    /* The limiter bounds depend on tau if we apply an affine shift: */
+    const bool reuse_bounds =
+        reuse_first_stage && !shallow_water && !View::have_source_terms;
+
+    if (first_stage && !reuse_first_stage)
+      first_stage_valid_ = false;
+
+    const bool use_swap_storage = reuse_on_restart_ && !first_stage;
+    const auto swap_storage = [&]() {
+      std::swap(dij_matrix_, dij_matrix_swap_);
+      alpha_.swap(alpha_swap_);
+      bounds_.swap(bounds_swap_);
+    };
+
+    if (use_swap_storage)
+      swap_storage();
+
+    /*
+     * A small lambda that (re)computes all off-diagonal entries of row i
+     * of the d_ij matrix and stores the result in dij_row. Entries
+     * associated with coupling boundary pairs are taken from
+     * dij_coupling_. This lambda is only used if recompute_dij_ is set.
+     *
+     * Note: Contrary to the stored d_ij matrix the recomputed entries d_ij
+     * and d_ji are only symmetric up to round-off (similarly to d_ij of
+     * couplings over MPI rank boundaries).
+     */
+    const auto compute_dij_row = [&](auto &riemann_solver,
+                                     auto &dij_row,
+                                     const unsigned int i,
+                                     const auto &U_i,
+                                     const unsigned int row_length) {
+      using T = typename std::decay_t<decltype(dij_row)>::value_type;
+      const unsigned int stride_size = get_stride_size<T>;
+
+      dij_row.resize_fast(row_length);
+      dij_row[0] = T(0.);
+
+      /* Skip diagonal. */
+      const unsigned int *js = sparsity_simd.columns(i) + stride_size;
+      for (unsigned int col_idx = 1; col_idx < row_length;
+           ++col_idx, js += stride_size) {
+
+        const auto U_j = old_U.template get_tensor<T>(js);
+        const auto c_ij = cij_matrix.template get_tensor<T>(i, col_idx);
+
+        const auto norm = c_ij.norm();
+        const auto n_ij = c_ij / norm;
+        const auto lambda_max = riemann_solver.compute(U_i, U_j, i, js, n_ij);
+        dij_row[col_idx] = norm * lambda_max;
+      }
+
+      /*
+       * Fix up all entries that belong to coupling boundary pairs. The
+       * vector coupling_boundary_pairs is sorted by row index and column
+       * index.
+       */
+      auto it = std::lower_bound(coupling_boundary_pairs.begin(),
+                                 coupling_boundary_pairs.end(),
+                                 i,
+                                 [](const auto &pair, const unsigned int row) {
+                                   return std::get<0>(pair) < row;
+                                 });
+      for (; it != coupling_boundary_pairs.end() &&
+             std::get<0>(*it) < i + stride_size;
+           ++it) {
+        const auto &[row, col_idx, j] = *it;
+        const auto k = std::distance(coupling_boundary_pairs.begin(), it);
+        write_lane(dij_row[col_idx], row - i, dij_coupling_[k]);
+      }
+    };
+
     /*
      * -------------------------------------------------------------------------
      * Step 2: Compute off-diagonal d_ij, and alpha_i
@@ -328,16 +532,25 @@ namespace ryujin
      *      r ......
      *      r ......
      *
-     *  and symmetrize in Step 2.
+     *  by iterating over the edge list (see EdgeListSIMD). The row i owns
+     *  the edge (i,j) and writes the computed value to the d_ij and d_ji
+     *  entries. Every entry is thus written exactly once and no further
+     *  symmetrization is needed (except for coupling boundary pairs in
+     *  Step 3).
      *
      *  MM: We could save a bit more computational resources by only
      *  computing entries for which *IN A GLOBAL* enumeration j > i. But
      *  the index translation, subsequent symmetrization, and exchange
      *  sounds a bit too expensive...
+     *
+     *  If recompute_dij_ is set we do not store d_ij at all. Instead, we
+     *  first compute d_ij for all coupling boundary pairs (where d_ij !=
+     *  d_ji), and then compute full rows of d_ij in order to set up the
+     *  diagonal d_ii. The off-diagonal entries are recomputed in Step 4.
      * -------------------------------------------------------------------------
      */
 
-    {
+    if (!reuse_first_stage) {
       Scope scope(computing_timer_, scoped_name("compute d_ij, and alpha_i"));
 
       SynchronizationDispatch synchronization_dispatch([&]() {
@@ -348,6 +561,43 @@ namespace ryujin
       RYUJIN_PARALLEL_REGION_BEGIN
       LIKWID_MARKER_START(("time_step_" + std::to_string(step_no)).c_str());
 
+      if (recompute_dij_) {
+        /*
+         * Precompute d_ij = max(d_ij, d_ji) for all coupling boundary
+         * pairs. Both entries of a pair (i, j) and (j, i) perform the
+         * identical computation which ensures that the result is
+         * symmetric.
+         */
+
+        using RiemannSolver =
+            typename Description::template RiemannSolver<dim, Number>;
+        RiemannSolver riemann_solver(
+            *hyperbolic_system_, riemann_solver_parameters_, old_precomputed);
+
+        RYUJIN_OMP_FOR
+        for (std::size_t k = 0; k < coupling_boundary_pairs.size(); ++k) {
+          const auto &[i, col_idx, j] = coupling_boundary_pairs[k];
+
+          const auto U_i = old_U.get_tensor(i);
+          const auto U_j = old_U.get_tensor(j);
+
+          const auto c_ij = cij_matrix.get_tensor(i, col_idx);
+          const auto norm_ij = c_ij.norm();
+          const auto n_ij = c_ij / norm_ij;
+
+          const auto c_ji = cij_matrix.get_transposed_tensor(i, col_idx);
+          const auto norm_ji = c_ji.norm();
+          const auto n_ji = c_ji / norm_ji;
+
+          const auto d_ij =
+              norm_ij * riemann_solver.compute(U_i, U_j, i, &j, n_ij);
+          const auto d_ji =
+              norm_ji * riemann_solver.compute(U_j, U_i, j, &i, n_ji);
+
+          dij_coupling_[k] = std::max(d_ij, d_ji);
+        }
+      }
+
       auto loop = [&](auto sentinel, unsigned int left, unsigned int right) {
         using T = decltype(sentinel);
         unsigned int stride_size = get_stride_size<T>;
@@ -363,9 +613,9 @@ namespace ryujin
         Indicator indicator(
             *hyperbolic_system_, indicator_parameters_, old_precomputed);
 
-        bool thread_ready = false;
+        AlignedVector<T> dij_row;
 
-        RYUJIN_OMP_FOR
+        RYUJIN_OMP_FOR_NOWAIT
         for (unsigned int i = left; i < right; i += stride_size) {
 
           /* Skip constrained degrees of freedom: */
@@ -373,9 +623,6 @@ namespace ryujin
           if (row_length == 1)
             continue;
 
-          synchronization_dispatch.check(
-              thread_ready, i >= n_export_indices && i < n_internal);
-
           const auto U_i = old_U.template get_tensor<T>(i);
 
           indicator.reset(i, U_i);
@@ -389,22 +636,41 @@ namespace ryujin
             const auto c_ij = cij_matrix.template get_tensor<T>(i, col_idx);
 
             indicator.accumulate(js, U_j, c_ij);
+          }
 
-            /* Skip diagonal. */
-            if (col_idx == 0)
-              continue;
+          if (!recompute_dij_) {
+            /* Only iterate over the upper triangular portion of d_ij: */
+            const unsigned int n_batches = edge_list.n_batches(i);
+            const unsigned int *positions = edge_list.positions(i);
+            const unsigned int *lane_masks = edge_list.lane_masks(i);
+            const unsigned int *js_row = sparsity_simd.columns(i);
 
-            /* Only iterate over the upper triangular portion of d_ij */
-            if (all_below_diagonal<T>(i, js))
-              continue;
+            for (unsigned int b = 0; b < n_batches; ++b) {
+              const unsigned int col_idx = positions[b];
+              const unsigned int *js = js_row + col_idx * stride_size;
 
-            const auto norm = c_ij.norm();
-            const auto n_ij = c_ij / norm;
-            const auto lambda_max =
-                riemann_solver.compute(U_i, U_j, i, js, n_ij);
-            const auto d_ij = norm * lambda_max;
+              const auto U_j = old_U.template get_tensor<T>(js);
+              const auto c_ij = cij_matrix.template get_tensor<T>(i, col_idx);
 
-            dij_matrix_.write_entry(d_ij, i, col_idx, true);
+              const auto norm = c_ij.norm();
+              const auto n_ij = c_ij / norm;
+              const auto lambda_max =
+                  riemann_solver.compute(U_i, U_j, i, js, n_ij);
+              const auto d_ij = norm * lambda_max;
+
+              write_edge(dij_matrix_, d_ij, i, col_idx, lane_masks[b]);
+            }
+          } else {
+            compute_dij_row(riemann_solver, dij_row, i, U_i, row_length);
+
+            T d_sum = T(0.);
+            for (unsigned int col_idx = 1; col_idx < row_length; ++col_idx)
+              d_sum -= dij_row[col_idx];
+
+            /* See Step 3 for the regularization: */
+            d_sum = std::min(
+                d_sum, T(Number(-1.e6) * std::numeric_limits<Number>::min()));
+            write_entry<T>(dii_, d_sum, i);
           }
 
           const auto mass = get_entry<T>(lumped_mass_matrix, i);
@@ -413,10 +679,23 @@ namespace ryujin
         }
       };
 
-      /* Parallel non-vectorized loop: */
+      /*
+       * All row loops are declared "nowait": every row only writes to its
+       * own entries (and, for d_ij, to the transposed entries of the edges
+       * it owns), so threads can proceed from one index range to the next
+       * without synchronization. The implicit barrier at the end of the
+       * parallel region is the only synchronization point.
+       *
+       * We first work on the non-vectorized range and the export indices
+       * [0, n_export_indices). Every thread then signals that its share of
+       * rows needed by other MPI ranks is done, which starts the ghost
+       * exchange while the remaining internal rows are processed.
+       */
+      bool thread_ready = false;
       loop(Number(), n_internal, n_owned);
-      /* Parallel vectorized SIMD loop: */
-      loop(VA(), 0, n_internal);
+      loop(VA(), 0, n_export_indices);
+      synchronization_dispatch.check(thread_ready, true);
+      loop(VA(), n_export_indices, n_internal);
 
       LIKWID_MARKER_STOP(("time_step_" + std::to_string(step_no)).c_str());
       RYUJIN_PARALLEL_REGION_END
@@ -430,7 +709,15 @@ namespace ryujin
 
     std::atomic<Number> tau_max{std::numeric_limits<Number>::max()};
 
-    {
+    if (reuse_first_stage) {
+      /*
+       * Reuse d_ij and alpha_i of the failed attempt and rescale tau_max
+       * to the current CFL number:
+       */
+      step_no += 2;
+      tau_max.store(first_stage_tau_max_ * (cfl_ / first_stage_cfl_));
+
+    } else {
       Scope scope(computing_timer_,
                   scoped_name("compute bdry d_ij, diag d_ii, and tau_max"));
 
@@ -438,82 +725,102 @@ namespace ryujin
       RYUJIN_PARALLEL_REGION_BEGIN
       LIKWID_MARKER_START(("time_step_" + std::to_string(step_no)).c_str());
 
-      /*
-       * Complete d_ij at boundary:
-       *
-       * Here, for continuous finite elements the assumption c_ij = -c_ji
-       * no longer holds true. This implies that d_ij != d_ji. We thus need
-       * to compute the lower-triangular part of d_ij, where i and j are
-       * boundary degrees of freedom as well.
-       */
+      Number local_tau_max = std::numeric_limits<Number>::max();
 
-      using RiemannSolver =
-          typename Description::template RiemannSolver<dim, Number>;
-      RiemannSolver riemann_solver(
-          *hyperbolic_system_, riemann_solver_parameters_, old_precomputed);
+      if (recompute_dij_) {
+        /* The diagonal d_ii has already been computed in Step 2: */
 
-      Number local_tau_max = std::numeric_limits<Number>::max();
+        RYUJIN_OMP_FOR_NOWAIT
+        for (unsigned int i = 0; i < n_owned; ++i) {
 
-      /*
-       * Note: we need this dance of iterating over an integer and then
-       * accessing the element to make Apple's OpenMP implementation
-       * happy.
-       */
-      RYUJIN_OMP_FOR
-      for (std::size_t k = 0; k < coupling_boundary_pairs.size(); ++k) {
-        const auto &[i, col_idx, j] = coupling_boundary_pairs[k];
+          /* Skip constrained degrees of freedom: */
+          const unsigned int row_length = sparsity_simd.row_length(i);
+          if (row_length == 1)
+            continue;
 
+          const Number d_sum = dii_.local_element(i);
+          const Number mass = lumped_mass_matrix.local_element(i);
+          const Number tau = cfl_ * mass / (Number(-2.) * d_sum);
+          local_tau_max = std::min(local_tau_max, tau);
+        }
+
+      } else {
         /*
-         * Only work on index pairs "i < j" that point to the upper
-         * triangular portion of the d_ij matrix. For all of these index
-         * pairs we compute the corresponding d_ji entry and fix up the
-         * d_ij entry (from step 2) by taking the maximum. Note that we
-         * actually do not store anything in the d_ji entry itself because
-         * we symmetrize the matrix later on anyway.
+         * Complete d_ij at boundary:
+         *
+         * Here, for continuous finite elements the assumption c_ij =
+         * -c_ji no longer holds true. This implies that d_ij != d_ji. We
+         * thus need to compute the lower-triangular part of d_ij, where i
+         * and j are boundary degrees of freedom as well.
          */
-        if (j < i)
-          continue;
 
-        const auto U_i = old_U.get_tensor(i);
-        const auto U_j = old_U.get_tensor(j);
+        using RiemannSolver =
+            typename Description::template RiemannSolver<dim, Number>;
+        RiemannSolver riemann_solver(
+            *hyperbolic_system_, riemann_solver_parameters_, old_precomputed);
 
-        const auto c_ji = cij_matrix.get_transposed_tensor(i, col_idx);
-        Assert(c_ji.norm() > 1.e-12, ExcInternalError());
-        const auto norm_ji = c_ji.norm();
-        const auto n_ji = c_ji / norm_ji;
+        /*
+         * Note: we need this dance of iterating over an integer and then
+         * accessing the element to make Apple's OpenMP implementation
+         * happy.
+         */
+        RYUJIN_OMP_FOR
+        for (std::size_t k = 0; k < coupling_boundary_pairs.size(); ++k) {
+          const auto &[i, col_idx, j] = coupling_boundary_pairs[k];
 
-        const auto d_ij = dij_matrix_.get_entry(i, col_idx);
+          /*
+           * Only work on index pairs "i < j" that point to the upper
+           * triangular portion of the d_ij matrix. For all of these index
+           * pairs we compute the corresponding d_ji entry and fix up the
+           * d_ij and d_ji entries (from step 2) by taking the maximum.
+           */
+          if (j < i)
+            continue;
 
-        const auto lambda_max = riemann_solver.compute(U_j, U_i, j, &i, n_ji);
-        const auto d_ji = norm_ji * lambda_max;
+          const auto U_i = old_U.get_tensor(i);
+          const auto U_j = old_U.get_tensor(j);
 
-        dij_matrix_.write_entry(std::max(d_ij, d_ji), i, col_idx);
-      }
+          const auto c_ji = cij_matrix.get_transposed_tensor(i, col_idx);
+          Assert(c_ji.norm() > 1.e-12, ExcInternalError());
+          const auto norm_ji = c_ji.norm();
+          const auto n_ji = c_ji / norm_ji;
 
-      /* Symmetrize d_ij: */
+          const auto d_ij = dij_matrix_.template get_entry<Number>(i, col_idx);
 
-      RYUJIN_OMP_FOR
-      for (unsigned int i = 0; i < n_owned; ++i) {
+          const auto lambda_max =
+              riemann_solver.compute(U_j, U_i, j, &i, n_ji);
+          const auto d_ji = norm_ji * lambda_max;
+
+          dij_matrix_.write_entry(std::max(d_ij, d_ji), i, col_idx);
+          dij_matrix_.write_transposed_entry(std::max(d_ij, d_ji), i, col_idx);
+        }
 
-        /* Skip constrained degrees of freedom: */
-        const unsigned int row_length = sparsity_simd.row_length(i);
-        if (row_length == 1)
-          continue;
+        /*
+         * Compute diagonal. The loop is "nowait" because the thread-local
+         * tau_max is merged atomically below:
+         */
+
+        RYUJIN_OMP_FOR_NOWAIT
+        for (unsigned int i = 0; i < n_owned; ++i) {
 
-        Number d_sum = Number(0.);
+          /* Skip constrained degrees of freedom: */
+          const unsigned int row_length = sparsity_simd.row_length(i);
+          if (row_length == 1)
+            continue;
 
-        /* skip diagonal: */
-        const unsigned int *js = sparsity_simd.columns(i);
-        for (unsigned int col_idx = 1; col_idx < row_length; ++col_idx) {
-          const auto j =
-              *(i < n_internal ? js + col_idx * simd_length : js + col_idx);
+          Number d_sum = Number(0.);
 
-          // fill lower triangular part of dij_matrix missing from step 1
-          if (j < i) {
-            const auto d_ji = dij_matrix_.get_transposed_entry(i, col_idx);
+          /* skip diagonal: */
+          [[maybe_unused]] const unsigned int *js = sparsity_simd.columns(i);
+          for (unsigned int col_idx = 1; col_idx < row_length; ++col_idx) {
+            const auto d_ij =
+                dij_matrix_.template get_entry<Number>(i, col_idx);
 
 #ifdef DEBUG
-            /* Verify that d_ji == std::max(d_ij, d_ji): */
+            /* Verify that d_ij == std::max(d_ij, d_ji): */
+
+            const auto j =
+                *(i < n_internal ? js + col_idx * simd_length : js + col_idx);
 
             const auto U_i = old_U.get_tensor(i);
             const auto U_j = old_U.get_tensor(j);
@@ -525,33 +832,30 @@ namespace ryujin
 
             const auto lambda_max =
                 riemann_solver.compute(U_i, U_j, i, &j, n_ij);
-            const auto d_ij = norm_ij * lambda_max;
 
-            Assert(d_ij <= d_ji + 1.0e-12,
+            Assert(norm_ij * lambda_max <= d_ij + 1.0e-12,
                    dealii::ExcMessage("d_ij not symmetrized correctly on "
                                       "boundary degrees of freedom."));
 #endif
 
-            dij_matrix_.write_entry(d_ji, i, col_idx);
+            d_sum -= d_ij;
           }
 
-          d_sum -= dij_matrix_.get_entry(i, col_idx);
-        }
-
-        /*
-         * Make sure that we do not accidentally divide by zero. (Yes, this
-         * can happen for some (admittedly, rather esoteric) scalar
-         * conservation equations...).
-         */
-        d_sum =
-            std::min(d_sum, Number(-1.e6) * std::numeric_limits<Number>::min());
+          /*
+           * Make sure that we do not accidentally divide by zero. (Yes, this
+           * can happen for some (admittedly, rather esoteric) scalar
+           * conservation equations...).
+           */
+          d_sum = std::min(d_sum,
+                           Number(-1.e6) * std::numeric_limits<Number>::min());
 
-        /* write diagonal element */
-        dij_matrix_.write_entry(d_sum, i, 0);
+          /* write diagonal element */
+          dij_matrix_.write_entry(d_sum, i, 0);
 
-        const Number mass = lumped_mass_matrix.local_element(i);
-        const Number tau = cfl_ * mass / (Number(-2.) * d_sum);
-        local_tau_max = std::min(local_tau_max, tau);
+          const Number mass = lumped_mass_matrix.local_element(i);
+          const Number tau = cfl_ * mass / (Number(-2.) * d_sum);
+          local_tau_max = std::min(local_tau_max, tau);
+        }
       }
 
       /* Synchronize tau max over all threads: */
@@ -578,6 +882,12 @@ namespace ryujin
 
       tau = (tau == Number(0.) ? tau_max.load() : tau);
 
+      if (reuse_on_restart_ && first_stage && !reuse_first_stage) {
+        first_stage_tau_max_ = tau_max.load();
+        first_stage_cfl_ = cfl_;
+        first_stage_valid_ = true;
+      }
+
 #ifdef DEBUG_OUTPUT
       std::cout << "        computed tau_max = " << tau_max << std::endl;
       std::cout << "        perform time-step with tau = " << tau << std::endl;
@@ -586,7 +896,8 @@ namespace ryujin
 
 #ifdef DEBUG
     /*  Exchange d_ij so that we can check for symmetry: */
-    dij_matrix_.update_ghost_rows();
+    if (!recompute_dij_)
+      dij_matrix_.update_ghost_rows();
 #endif
 
     /*
@@ -638,9 +949,13 @@ namespace ryujin
         /* Stored thread locally: */
         Limiter limiter(
             *hyperbolic_system_, limiter_parameters_, old_precomputed);
-        bool thread_ready = false;
+        using RiemannSolver =
+            typename Description::template RiemannSolver<dim, T>;
+        RiemannSolver riemann_solver(
+            *hyperbolic_system_, riemann_solver_parameters_, old_precomputed);
+        AlignedVector<T> dij_row;
 
-        RYUJIN_OMP_FOR
+        RYUJIN_OMP_FOR_NOWAIT
         for (unsigned int i = left; i < right; i += stride_size) {
 
           /* Skip constrained degrees of freedom: */
@@ -648,12 +963,20 @@ namespace ryujin
           if (row_length == 1)
             continue;
 
-          synchronization_dispatch.check(
-              thread_ready, i >= n_export_indices && i < n_internal);
-
           const auto U_i = old_U.template get_tensor<T>(i);
           auto U_i_new = U_i;
 
+          if (recompute_dij_) {
+            compute_dij_row(riemann_solver, dij_row, i, U_i, row_length);
+            dij_row[0] = get_entry<T>(dii_, i);
+          }
+
+          const auto get_dij = [&](const unsigned int col_idx) {
+            return recompute_dij_
+                       ? dij_row[col_idx]
+                       : dij_matrix_.template get_entry<T>(i, col_idx);
+          };
+
           const auto alpha_i = get_entry<T>(alpha_, i);
           const auto m_i = get_entry<T>(lumped_mass_matrix, i);
           const auto m_i_inv = get_entry<T>(lumped_mass_matrix_inverse, i);
@@ -687,7 +1010,8 @@ namespace ryujin
             F_iH += m_i * S_iH;
           }
 
-          limiter.reset(i, U_i, flux_i);
+          if (!reuse_bounds)
+            limiter.reset(i, U_i, flux_i);
 
           [[maybe_unused]] state_type affine_shift;
 
@@ -706,7 +1030,7 @@ namespace ryujin
               const auto flux_j = view.flux_contribution(
                   old_precomputed, initial_precomputed_, js, U_j);
 
-              const auto d_ij = dij_matrix_.template get_entry<T>(i, col_idx);
+              const auto d_ij = get_dij(col_idx);
               const auto c_ij = cij_matrix.template get_tensor<T>(i, col_idx);
 
               const auto B_ij = view.affine_shift(flux_i, flux_j, c_ij, d_ij);
@@ -728,7 +1052,7 @@ namespace ryujin
 
             const auto alpha_j = get_entry<T>(alpha_, js);
 
-            const auto d_ij = dij_matrix_.template get_entry<T>(i, col_idx);
+            const auto d_ij = get_dij(col_idx);
             auto factor = (alpha_i + alpha_j) * Number(.5);
 
             if constexpr (have_discontinuous_ansatz) {
@@ -746,11 +1070,14 @@ namespace ryujin
              * all ghost rows from neighboring MPI ranks and simply check
              * that the (local) values of d_ij and d_ji match.
              */
-            const auto d_ji =
-                dij_matrix_.template get_transposed_entry<T>(i, col_idx);
-            Assert(std::max(std::abs(d_ij - d_ji), T(1.0e-12)) == T(1.0e-12),
-                   dealii::ExcMessage(
-                       "d_ij not symmetrized correctly over MPI ranks"));
+            if (!recompute_dij_) {
+              const auto d_ji =
+                  dij_matrix_.template get_transposed_entry<T>(i, col_idx);
+              Assert(std::max(std::abs(d_ij - d_ji), T(1.0e-12)) ==
+                         T(1.0e-12),
+                     dealii::ExcMessage(
+                         "d_ij not symmetrized correctly over MPI ranks"));
+            }
 #endif
 
             const auto c_ij = cij_matrix.template get_tensor<T>(i, col_idx);
@@ -783,8 +1110,9 @@ namespace ryujin
               F_iH += d_ijH * (U_star_ji - U_star_ij);
               P_ij += (d_ijH - d_ij) * (U_star_ji - U_star_ij);
 
-              limiter.accumulate(
-                  U_j, U_star_ij, U_star_ji, scaled_c_ij, affine_shift);
+              if (!reuse_bounds)
+                limiter.accumulate(
+                    U_j, U_star_ij, U_star_ji, scaled_c_ij, affine_shift);
 
             } else {
 
@@ -792,7 +1120,9 @@ namespace ryujin
               F_iH += d_ijH * (U_j - U_i);
               P_ij += (d_ijH - d_ij) * (U_j - U_i);
 
-              limiter.accumulate(js, U_j, flux_j, scaled_c_ij, affine_shift);
+              if (!reuse_bounds)
+                limiter.accumulate(
+                    js, U_j, flux_j, scaled_c_ij, affine_shift);
             }
 
             if constexpr (View::have_source_terms) {
@@ -858,9 +1188,11 @@ namespace ryujin
           new_U.template write_tensor<T>(U_i_new, i);
           r_.template write_tensor<T>(F_iH, i);
 
-          const auto hd_i = m_i * measure_of_omega_inverse;
-          const auto relaxed_bounds = limiter.bounds(hd_i);
-          bounds_.template write_tensor<T>(relaxed_bounds, i);
+          if (!reuse_bounds) {
+            const auto hd_i = m_i * measure_of_omega_inverse;
+            const auto relaxed_bounds = limiter.bounds(hd_i);
+            bounds_.template write_tensor<T>(relaxed_bounds, i);
+          }
         }
       };
 
@@ -870,15 +1202,19 @@ namespace ryujin
        * (constexpr) integral constant later on to avoid branching when
        * computing d_ijH.
        */
-      if (offline_data_->discretization().have_discontinuous_ansatz()) {
-        /* Parallel non-vectorized loop and vectorized SIMD loop: */
-        loop(Number(), std::true_type{}, n_internal, n_owned);
-        loop(VA(), std::true_type{}, 0, n_internal);
-      } else {
-        /* Parallel non-vectorized loop and vectorized SIMD loop: */
-        loop(Number(), std::false_type{}, n_internal, n_owned);
-        loop(VA(), std::false_type{}, 0, n_internal);
-      }
+      const auto run_loops = [&](auto have_discontinuous_ansatz) {
+        /* Non-vectorized and export rows first, see Step 2: */
+        bool thread_ready = false;
+        loop(Number(), have_discontinuous_ansatz, n_internal, n_owned);
+        loop(VA(), have_discontinuous_ansatz, 0, n_export_indices);
+        synchronization_dispatch.check(thread_ready, true);
+        loop(VA(), have_discontinuous_ansatz, n_export_indices, n_internal);
+      };
+
+      if (offline_data_->discretization().have_discontinuous_ansatz())
+        run_loops(std::true_type{});
+      else
+        run_loops(std::false_type{});
 
       LIKWID_MARKER_STOP(("time_step_" + std::to_string(step_no)).c_str());
       RYUJIN_PARALLEL_REGION_END
@@ -915,9 +1251,8 @@ namespace ryujin
         /* Stored thread locally: */
         Limiter limiter(
             *hyperbolic_system_, limiter_parameters_, old_precomputed);
-        bool thread_ready = false;
 
-        RYUJIN_OMP_FOR
+        RYUJIN_OMP_FOR_NOWAIT
         for (unsigned int i = left; i < right; i += stride_size) {
 
           /* Skip constrained degrees of freedom: */
@@ -925,9 +1260,6 @@ namespace ryujin
           if (row_length == 1)
             continue;
 
-          synchronization_dispatch.check(
-              thread_ready, i >= n_export_indices && i < n_internal);
-
           auto bounds =
               bounds_.template get_tensor<T, std::array<T, n_bounds>>(i);
 
@@ -1026,15 +1358,19 @@ namespace ryujin
        * (constexpr) integral constant later on to avoid branching when
        * computing d_ijH.
        */
-      if (offline_data_->discretization().have_discontinuous_ansatz()) {
-        /* Parallel non-vectorized loop and vectorized SIMD loop: */
-        loop(Number(), std::true_type{}, n_internal, n_owned);
-        loop(VA(), std::true_type{}, 0, n_internal);
-      } else {
-        /* Parallel non-vectorized loop and vectorized SIMD loop: */
-        loop(Number(), std::false_type{}, n_internal, n_owned);
-        loop(VA(), std::false_type{}, 0, n_internal);
-      }
+      const auto run_loops = [&](auto have_discontinuous_ansatz) {
+        /* Non-vectorized and export rows first, see Step 2: */
+        bool thread_ready = false;
+        loop(Number(), have_discontinuous_ansatz, n_internal, n_owned);
+        loop(VA(), have_discontinuous_ansatz, 0, n_export_indices);
+        synchronization_dispatch.check(thread_ready, true);
+        loop(VA(), have_discontinuous_ansatz, n_export_indices, n_internal);
+      };
+
+      if (offline_data_->discretization().have_discontinuous_ansatz())
+        run_loops(std::true_type{});
+      else
+        run_loops(std::false_type{});
 
       LIKWID_MARKER_STOP(("time_step_" + std::to_string(step_no)).c_str());
       RYUJIN_PARALLEL_REGION_END
@@ -1085,9 +1421,8 @@ namespace ryujin
         AlignedVector<T> lij_row;
         Limiter limiter(
             *hyperbolic_system_, limiter_parameters_, old_precomputed);
-        bool thread_ready = false;
 
-        RYUJIN_OMP_FOR
+        RYUJIN_OMP_FOR_NOWAIT
         for (unsigned int i = left; i < right; i += stride_size) {
 
           /* Skip constrained degrees of freedom: */
@@ -1095,9 +1430,6 @@ namespace ryujin
           if (row_length == 1)
             continue;
 
-          synchronization_dispatch.check(
-              thread_ready, i >= n_export_indices && i < n_internal);
-
           auto U_i_new = new_U.template get_tensor<T>(i);
 
           const Number lambda = Number(1.) / Number(row_length - 1);
@@ -1172,10 +1504,12 @@ namespace ryujin
         }
       };
 
-      /* Parallel non-vectorized loop: */
+      /* Non-vectorized and export rows first, see Step 2: */
+      bool thread_ready = false;
       loop(Number(), n_internal, n_owned);
-      /* Parallel vectorized SIMD loop: */
-      loop(VA(), 0, n_internal);
+      loop(VA(), 0, n_export_indices);
+      synchronization_dispatch.check(thread_ready, true);
+      loop(VA(), n_export_indices, n_internal);
 
       LIKWID_MARKER_STOP(("time_step_" + std::to_string(step_no)).c_str());
       RYUJIN_PARALLEL_REGION_END
@@ -1195,6 +1529,10 @@ namespace ryujin
           Utilities::MPI::logical_or(restart_needed.load(), mpi_communicator_));
     }
 
+    /* Restore the first-stage data in the primary storage: */
+    if (use_swap_storage)
+      swap_storage();
+
     if (restart_needed) {
       switch (id_violation_strategy_) {
       case IDViolationStrategy::warn:
@@ -57,6 +57,10 @@ namespace ryujin
      * and enforce Dirichlet boundary conditions. For the latter, the
      * function signature has an additional parameter @p t denoting the
      * current time to allow for time-dependent (in-flow) Dirichlet data.
+     *
+     * @note The function is called concurrently from multiple threads
+     * when evaluating Dirichlet boundary data and thus has to be thread
+     * safe.
      */
     virtual state_type compute(const dealii::Point<dim> &point, Number t) = 0;
 
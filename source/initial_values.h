@@ -13,6 +13,7 @@
 #include <deal.II/base/parameter_acceptor.h>
 #include <deal.II/base/tensor.h>
 
+#include <array>
 #include <functional>
 
 namespace ryujin
@@ -116,13 +117,56 @@ namespace ryujin
      */
     HyperbolicVector interpolate_hyperbolic_vector(Number t = 0) const;
 
-
     /**
      * This routine computes and returns a state vector populated with
      * initial values for a specified time @p t.
      */
     InitialPrecomputedVector interpolate_initial_precomputed_vector() const;
 
+    //@}
+    /**
+     * @name Cached Dirichlet boundary data
+     */
+    //@{
+
+    /**
+     * Prepare the cache of Dirichlet boundary data. The function has to
+     * be called after OfflineData::prepare() whenever the mesh changed.
+     * If boundary data is declared to be time independent it is evaluated
+     * once for every entry of OfflineData::boundary_map_soa() that might
+     * need Dirichlet data.
+     */
+    void prepare();
+
+    /**
+     * Make sure that the cache of Dirichlet boundary data is valid for
+     * time @p t. This is a no-op if boundary data is time independent. If
+     * a tabulation interval is set, boundary data is tabulated at
+     * multiples of the tabulation interval bracketing @p t. Otherwise,
+     * boundary data is evaluated for time @p t.
+     *
+     * @note The boundary data is evaluated thread parallel. Thus, this
+     * function must not be called from within a parallel region. It has to
+     * be called before boundary_state() is used within a parallel region.
+     */
+    void update_boundary_data(Number t) const;
+
+    /**
+     * Return the cached Dirichlet data for entry @p k of
+     * OfflineData::boundary_map_soa() at the time specified with the last
+     * call to update_boundary_data(). This function is thread safe.
+     */
+    DEAL_II_ALWAYS_INLINE inline state_type
+    boundary_state(const unsigned int k) const
+    {
+      if (boundary_data_time_independent_ ||
+          boundary_data_tabulation_interval_ <= Number(0.))
+        return boundary_data_[0][k];
+
+      return (Number(1.) - boundary_data_theta_) * boundary_data_[0][k] +
+             boundary_data_theta_ * boundary_data_[1][k];
+    }
+
   private:
     //@}
     /**
@@ -138,6 +182,10 @@ namespace ryujin
 
     Number perturbation_;
 
+    bool boundary_data_time_independent_;
+
+    Number boundary_data_tabulation_interval_;
+
     //@}
     /**
      * @name Internal data:
@@ -153,9 +201,27 @@ namespace ryujin
     std::function<state_type(const dealii::Point<dim> &, Number)>
         initial_state_;
 
+    /**
+     * The initial state without the random perturbation. Used to compute
+     * cached Dirichlet boundary data.
+     */
+    std::function<state_type(const dealii::Point<dim> &, Number)>
+        unperturbed_initial_state_;
+
     std::function<initial_precomputed_type(const dealii::Point<dim> &)>
         initial_precomputed_;
 
+    /**
+     * Evaluate Dirichlet boundary data for all relevant entries of
+     * OfflineData::boundary_map_soa() at time @p t.
+     */
+    void compute_boundary_data(std::vector<state_type> &boundary_data,
+                               Number t) const;
+
+    mutable std::array<std::vector<state_type>, 2> boundary_data_;
+    mutable std::array<long int, 2> boundary_data_slices_;
+    mutable Number boundary_data_theta_;
+
     //@}
   };
 
@@ -6,11 +6,13 @@
 #pragma once
 
 #include "initial_values.h"
+#include "openmp.h"
 #include "simd.h"
 
 #include <deal.II/numerics/vector_tools.h>
 #include <deal.II/numerics/vector_tools.templates.h>
 
+#include <mutex>
 #include <random>
 
 namespace ryujin
@@ -52,7 +54,24 @@ namespace ryujin
     add_parameter("perturbation",
                   perturbation_,
                   "Add a random perturbation of the specified magnitude to the "
-                  "initial state.");
+                  "initial state. Cached Dirichlet boundary data is computed "
+                  "from the unperturbed initial state.");
+
+    boundary_data_time_independent_ = false;
+    add_parameter("boundary data time independent",
+                  boundary_data_time_independent_,
+                  "If set to true, the Dirichlet boundary data is assumed to "
+                  "be time independent. It is then evaluated once per mesh "
+                  "and served from a cache.");
+
+    boundary_data_tabulation_interval_ = 0.;
+    add_parameter(
+        "boundary data tabulation interval",
+        boundary_data_tabulation_interval_,
+        "If set to a positive value, time-dependent Dirichlet boundary data "
+        "is tabulated at multiples of the given interval and linearly "
+        "interpolated in between. Set to 0 to evaluate the boundary data "
+        "for every stage.");
 
     /*
      * And finally populate the initial state list with all initial state
@@ -159,6 +178,10 @@ namespace ryujin
                 ExcMessage("Initial direction is set to the zero vector."));
     initial_direction_ /= initial_direction_.norm();
 
+    AssertThrow(boundary_data_tabulation_interval_ >= 0.,
+                ExcMessage("The boundary data tabulation interval must be "
+                           "a nonnegative number."));
+
     /* Populate std::function object: */
 
     {
@@ -197,6 +220,8 @@ namespace ryujin
 
     /* Add a random perturbation to the original function object: */
 
+    unperturbed_initial_state_ = initial_state_;
+
     if (perturbation_ != 0.) {
       initial_state_ = [old_state = this->initial_state_,
                         perturbation = this->perturbation_](
@@ -210,6 +235,11 @@ namespace ryujin
             std::default_random_engine(std::random_device()());
         static std::uniform_real_distribution<Number> distribution(-1., 1.);
         static auto draw = std::bind(distribution, generator);
+
+        /* The function might be called thread parallel: */
+        static std::mutex mutex;
+        std::lock_guard<std::mutex> lock(mutex);
+
         for (unsigned int i = 0; i < problem_dimension; ++i)
           state[i] *= (Number(1.) + perturbation * draw());
 
@@ -219,6 +249,109 @@ namespace ryujin
   }
 
 
+  template <typename Description, int dim, typename Number>
+  void InitialValues<Description, dim, Number>::prepare()
+  {
+#ifdef DEBUG_OUTPUT
+    std::cout << "InitialValues<dim, Number>::prepare()" << std::endl;
+#endif
+
+    /* Invalidate all tabulated time slices: */
+    boundary_data_slices_ = {std::numeric_limits<long int>::min(),
+                             std::numeric_limits<long int>::min()};
+    boundary_data_theta_ = 0.;
+
+    boundary_data_[1].clear();
+
+    if (boundary_data_time_independent_)
+      compute_boundary_data(boundary_data_[0], Number(0.));
+    else
+      boundary_data_[0].clear();
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  void InitialValues<Description, dim, Number>::update_boundary_data(
+      Number t) const
+  {
+    if (boundary_data_time_independent_)
+      return;
+
+    const auto interval = boundary_data_tabulation_interval_;
+
+    if (interval <= Number(0.)) {
+      compute_boundary_data(boundary_data_[0], t);
+      return;
+    }
+
+    const long int n = static_cast<long int>(std::floor(t / interval));
+
+    if (n == boundary_data_slices_[0]) {
+      /* Nothing to do. */
+
+    } else if (n == boundary_data_slices_[1]) {
+      /* Advance by one time slice: */
+      std::swap(boundary_data_[0], boundary_data_[1]);
+      compute_boundary_data(boundary_data_[1], Number(n + 1) * interval);
+      boundary_data_slices_ = {n, n + 1};
+
+    } else {
+      compute_boundary_data(boundary_data_[0], Number(n) * interval);
+      compute_boundary_data(boundary_data_[1], Number(n + 1) * interval);
+      boundary_data_slices_ = {n, n + 1};
+    }
+
+    boundary_data_theta_ = (t - Number(n) * interval) / interval;
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  void InitialValues<Description, dim, Number>::compute_boundary_data(
+      std::vector<state_type> &boundary_data, Number t) const
+  {
+#ifdef DEBUG_OUTPUT
+    std::cout << "InitialValues<dim, Number>::compute_boundary_data(t = " << t
+              << ")" << std::endl;
+#endif
+
+    const auto &boundary_map_soa = offline_data_->boundary_map_soa();
+    const auto n_entries = boundary_map_soa.i.size();
+
+    boundary_data.resize(n_entries);
+
+    /*
+     * Cached boundary data must not freeze the random perturbation of
+     * the initial state into the Dirichlet data. Boundary data evaluated
+     * for every stage uses the (perturbed) initial state as before.
+     */
+    const bool cached = boundary_data_time_independent_ ||
+                        boundary_data_tabulation_interval_ > Number(0.);
+    const auto &state = cached ? unperturbed_initial_state_ : initial_state_;
+
+    /*
+     * Every entry has its own slot, so we can evaluate the boundary data
+     * thread parallel. InitialState::compute() is required to be thread
+     * safe.
+     */
+
+    RYUJIN_PARALLEL_REGION_BEGIN
+
+    RYUJIN_OMP_FOR
+    for (unsigned int k = 0; k < n_entries; ++k) {
+      const auto id = boundary_map_soa.id[k];
+
+      /* Only evaluate boundary data for boundary ids that need it: */
+      if (id != Boundary::dirichlet && id != Boundary::dynamic &&
+          id != Boundary::dirichlet_momentum)
+        continue;
+
+      boundary_data[k] = state(boundary_map_soa.position[k], t);
+    }
+
+    RYUJIN_PARALLEL_REGION_END
+  }
+
+
   template <typename Description, int dim, typename Number>
   auto InitialValues<Description, dim, Number>::interpolate_hyperbolic_vector(
       Number t) const -> HyperbolicVector
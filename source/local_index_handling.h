@@ -296,6 +296,92 @@ namespace ryujin
     }
 
 
+    /**
+     * Regroup the scalar index range \f$[\text{n_locally_internal},
+     * \text{n_locally_owned})\f$:
+     *
+     * All indices of the scalar range are sorted by the stencil size
+     * reported by the (final) sparsity pattern @p sparsity. Complete
+     * groups of @p group_size indices with identical stencil size are
+     * then appended to the locally internal index range. Only a remainder
+     * of at most @p group_size - 1 indices per stencil size is left in the
+     * scalar index range.
+     *
+     * This recovers SIMD strides that inconsistent_strides_last() had to
+     * give up on after the elimination of constrained degrees of freedom.
+     * The binning of the consistent range \f$[0,
+     * \text{n_locally_internal})\f$ is preserved.
+     *
+     * Returns the new right boundary n_internal of the internal index
+     * range.
+     *
+     * @ingroup FiniteElement
+     */
+    template <int dim>
+    unsigned int
+    regroup_scalar_range(dealii::DoFHandler<dim> &dof_handler,
+                         const dealii::DynamicSparsityPattern &sparsity,
+                         const unsigned int n_locally_internal,
+                         const std::size_t group_size)
+    {
+      using namespace dealii;
+
+      const IndexSet &locally_owned = dof_handler.locally_owned_dofs();
+      const auto n_locally_owned = locally_owned.n_elements();
+
+      /* The locally owned index range has to be contiguous */
+      Assert(locally_owned.is_contiguous() == true,
+             dealii::ExcMessage(
+                 "Need a contiguous set of locally owned indices."));
+
+      /* Offset to translate from global to local index range */
+      const auto offset = n_locally_owned != 0 ? *locally_owned.begin() : 0;
+
+      Assert(n_locally_internal <= n_locally_owned, dealii::ExcInternalError());
+      Assert(n_locally_internal % group_size == 0, dealii::ExcInternalError());
+
+      using dof_type = dealii::types::global_dof_index;
+      std::vector<dof_type> new_order(n_locally_owned);
+
+      for (unsigned int i = 0; i < n_locally_internal; ++i)
+        new_order[i] = offset + i;
+
+      /* Sort the scalar index range into bins of equal stencil size: */
+
+      std::map<unsigned int, std::vector<unsigned int>> bins;
+      for (unsigned int i = n_locally_internal; i < n_locally_owned; ++i)
+        bins[sparsity.row_length(offset + i)].push_back(i);
+
+      /*
+       * First pass: append complete groups. Second pass: append the
+       * remainder.
+       */
+
+      unsigned int running_index = n_locally_internal;
+
+      for (const auto &[row_length, indices] : bins) {
+        const auto n_complete = indices.size() / group_size * group_size;
+        for (std::size_t k = 0; k < n_complete; ++k)
+          new_order[indices[k]] = offset + running_index++;
+      }
+
+      const unsigned int n_regrouped = running_index;
+
+      for (const auto &[row_length, indices] : bins) {
+        const auto n_complete = indices.size() / group_size * group_size;
+        for (std::size_t k = n_complete; k < indices.size(); ++k)
+          new_order[indices[k]] = offset + running_index++;
+      }
+
+      Assert(running_index == n_locally_owned, dealii::ExcInternalError());
+
+      dof_handler.renumber_dofs(new_order);
+
+      Assert(n_regrouped % group_size == 0, dealii::ExcInternalError());
+      return n_regrouped;
+    }
+
+
     /**
      * Reorder indices:
      *
@@ -78,6 +78,27 @@ namespace ryujin
                                            unsigned int /*col_idx*/,
                                            unsigned int /*j*/>;
 
+    /**
+     * The boundary map reorganized into a structure of arrays holding
+     * the information needed to apply boundary conditions.
+     *
+     * Entries with Boundary::do_nothing are omitted. The remaining entries
+     * are grouped into consecutive layers [layer_starts[l],
+     * layer_starts[l+1]) such that every degree of freedom occurs at most
+     * once per layer and such that the relative order of multiple entries
+     * of the same degree of freedom is preserved. All entries of a layer
+     * can thus be processed in parallel. Within a layer, entries are
+     * sorted by boundary id so that every thread works on contiguous,
+     * boundary-id homogeneous ranges.
+     */
+    struct BoundaryMapSoA {
+      std::vector<unsigned int> i;
+      std::vector<dealii::Tensor<1, dim, Number>> normal;
+      std::vector<dealii::types::boundary_id> id;
+      std::vector<dealii::Point<dim>> position;
+      std::vector<unsigned int> layer_starts;
+    };
+
     /**
      * Constructor
      */
@@ -180,6 +201,13 @@ namespace ryujin
      */
     ACCESSOR_READ_ONLY(boundary_map)
 
+    /**
+     * The boundary map stored as a structure of arrays that is
+     * partitioned into layers of entries that can be processed in
+     * parallel. See BoundaryMapSoA for details.
+     */
+    ACCESSOR_READ_ONLY(boundary_map_soa)
+
     /**
      * A vector of tuples describing coupling degrees of freedom i and j
      * where both degrees of freedom are collocated at the boundary (and
@@ -197,19 +225,49 @@ namespace ryujin
     /**
      * A sparsity pattern for (standard deal.II) matrices storing indices
      * in (Deal.II typical) global numbering.
+     *
+     * @note Unless the runtime parameter "release sparsity pattern" is set
+     * to false, the pattern is only available between setup() and
+     * assemble(). It is recreated by the next call to setup() (for
+     * example after mesh adaptation).
      */
     ACCESSOR_READ_ONLY(sparsity_pattern)
 
+    /**
+     * Memory (in bytes) that was freed by releasing the sparsity pattern
+     * in assemble(). The pattern is released right after the (optional)
+     * intermediate sparsity pattern for assembly has been created, i.e.,
+     * before the matrices are allocated and assembled. Zero if the
+     * pattern was kept.
+     */
+    ACCESSOR_READ_ONLY(released_sparsity_pattern_memory)
+
     /**
      * A sparsity pattern for matrices in vectorized format. Local
      * numbering.
      */
     ACCESSOR_READ_ONLY(sparsity_pattern_simd)
 
+    /**
+     * The edge list associated with the SIMD sparsity pattern, i.e., all
+     * index pairs (i,j) with j > i for locally owned i. Local numbering.
+     */
+    ACCESSOR_READ_ONLY(edge_list_simd)
+
     /**
      * The mass matrix. (SIMD storage, local numbering)
+     *
+     * If COMPRESSED_OFFLINE_DATA is set the matrix is returned as a
+     * StencilSparseMatrixSIMD.
      */
+#ifdef COMPRESSED_OFFLINE_DATA
+    inline auto &mass_matrix() const
+    {
+      return mass_matrix_stencil_;
+    }
+#else
     ACCESSOR_READ_ONLY(mass_matrix)
+#endif
 
     /**
      * The inverse mass matrix. (SIMD storage, local numbering)
@@ -238,8 +296,24 @@ namespace ryujin
 
     /**
      * The \f$(c_{ij})\f$ matrix. (SIMD storage, local numbering)
+     *
+     * If ANTISYMMETRIC_CIJ_STORAGE is set the matrix is returned as an
+     * AntisymmetricSparseMatrixSIMD. If COMPRESSED_OFFLINE_DATA is set
+     * the matrix is returned as a StencilSparseMatrixSIMD.
      */
+#if defined(ANTISYMMETRIC_CIJ_STORAGE)
+    inline auto &cij_matrix() const
+    {
+      return cij_matrix_antisymmetric_;
+    }
+#elif defined(COMPRESSED_OFFLINE_DATA)
+    inline auto &cij_matrix() const
+    {
+      return cij_matrix_stencil_;
+    }
+#else
     ACCESSOR_READ_ONLY(cij_matrix)
+#endif
 
     /**
      * The incidence matrix \f$(beta_{ij})\f$: 1 for coupling face degrees
@@ -248,9 +322,17 @@ namespace ryujin
      * (SIMD storage, local numbering)
      *
      * This matrix is only available for a discontinuous finite Element
-     * ansatz.
+     * ansatz. If COMPRESSED_OFFLINE_DATA is set the matrix is returned as
+     * a StencilSparseMatrixSIMD.
      */
+#ifdef COMPRESSED_OFFLINE_DATA
+    inline auto &incidence_matrix() const
+    {
+      return incidence_matrix_stencil_;
+    }
+#else
     ACCESSOR_READ_ONLY(incidence_matrix)
+#endif
 
     /**
      * Size of computational domain.
@@ -314,16 +396,20 @@ namespace ryujin
 
     using BoundaryMap = std::vector<BoundaryDescription>;
     BoundaryMap boundary_map_;
+    BoundaryMapSoA boundary_map_soa_;
     std::vector<BoundaryMap> level_boundary_map_;
 
     using CouplingBoundaryPairs = std::vector<CouplingDescription>;
     CouplingBoundaryPairs coupling_boundary_pairs_;
 
     dealii::DynamicSparsityPattern sparsity_pattern_;
+    std::size_t released_sparsity_pattern_memory_;
 
     SparsityPatternSIMD<dealii::VectorizedArray<Number>::size()>
         sparsity_pattern_simd_;
 
+    EdgeListSIMD<dealii::VectorizedArray<Number>::size()> edge_list_simd_;
+
     SparseMatrixSIMD<Number> mass_matrix_;
     SparseMatrixSIMD<Number> mass_matrix_inverse_;
 
@@ -333,8 +419,19 @@ namespace ryujin
     std::vector<ScalarVectorFloat> level_lumped_mass_matrix_;
 
     SparseMatrixSIMD<Number, dim> cij_matrix_;
+#ifdef ANTISYMMETRIC_CIJ_STORAGE
+    AntisymmetricSparseMatrixSIMD<Number, dim> cij_matrix_antisymmetric_;
+#endif
     SparseMatrixSIMD<Number> incidence_matrix_;
 
+#ifdef COMPRESSED_OFFLINE_DATA
+    StencilSparseMatrixSIMD<Number> mass_matrix_stencil_;
+#ifndef ANTISYMMETRIC_CIJ_STORAGE
+    StencilSparseMatrixSIMD<Number, dim> cij_matrix_stencil_;
+#endif
+    StencilSparseMatrixSIMD<Number> incidence_matrix_stencil_;
+#endif
+
     Number measure_of_omega_;
 
     dealii::SmartPointer<const Discretization<dim>> discretization_;
@@ -350,6 +447,12 @@ namespace ryujin
         const ITERATOR2 &end,
         const dealii::Utilities::MPI::Partitioner &partitioner) const;
 
+    /**
+     * Reorganize a boundary map into a structure of arrays.
+     */
+    BoundaryMapSoA
+    construct_boundary_map_soa(const BoundaryMap &boundary_map) const;
+
     /**
      * Collect coupling pairs of locally owned (and locally relevant)
      * boundary degrees of freedom.
@@ -368,6 +471,8 @@ namespace ryujin
 
     double incidence_relaxation_even_;
     double incidence_relaxation_odd_;
+    bool release_sparsity_pattern_;
+    bool assemble_directly_;
 
     //@}
   };
@@ -40,6 +40,7 @@ namespace ryujin
       const Discretization<dim> &discretization,
       const std::string &subsection /*= "OfflineData"*/)
       : ParameterAcceptor(subsection)
+      , released_sparsity_pattern_memory_(0)
       , discretization_(&discretization)
       , mpi_communicator_(mpi_communicator)
   {
@@ -56,6 +57,21 @@ namespace ryujin
                   "Scaling exponent for incidence matrix used for "
                   "discontinuous finite elements with even degree. The default "
                   "value of 0.0 sets the jump penalization to a constant 1.");
+
+    release_sparsity_pattern_ = true;
+    add_parameter("release sparsity pattern",
+                  release_sparsity_pattern_,
+                  "Release the (globally indexed) dynamic sparsity pattern "
+                  "in assemble() before the matrices are allocated. The "
+                  "pattern is recreated by setup() after mesh adaptation.");
+
+    assemble_directly_ = true;
+    add_parameter("assemble directly",
+                  assemble_directly_,
+                  "Scatter cell contributions directly into the SIMD matrices "
+                  "if no affine constraints are present. If set to false the "
+                  "matrices are always assembled into intermediate sparse "
+                  "matrices and read in afterwards.");
   }
 
 
@@ -314,6 +330,27 @@ namespace ryujin
         create_constraints_and_sparsity_pattern();
         n_locally_internal_ = consistent_stride_range();
       }
+
+      /*
+       * Eliminating constraints changes the stencil size of affected rows
+       * and the strides we had to give up on above ended up in the scalar
+       * index range. Sort the scalar range by (final) stencil size and
+       * append all complete strides to the internal index range again.
+       * The remainder left for the scalar code path is at most
+       * VectorizedArray<Number>::size() - 1 rows per stencil size.
+       */
+      n_locally_internal_ = DoFRenumbering::regroup_scalar_range(
+          dof_handler,
+          sparsity_pattern_,
+          n_locally_internal_,
+          VectorizedArray<Number>::size());
+      n_export_indices_ =
+          DoFRenumbering::export_indices_first(dof_handler,
+                                               mpi_communicator_,
+                                               n_locally_internal_,
+                                               VectorizedArray<Number>::size());
+      create_constraints_and_sparsity_pattern();
+      n_locally_internal_ = consistent_stride_range();
     }
 #endif
 
@@ -398,6 +435,7 @@ namespace ryujin
 
     sparsity_pattern_simd_.reinit(
         n_locally_internal_, sparsity_pattern_, scalar_partitioner_);
+    edge_list_simd_.reinit(sparsity_pattern_simd_);
 
     /*
      * Next we can (re)initialize all local matrices:
@@ -427,6 +465,43 @@ namespace ryujin
 
     measure_of_omega_ = 0.;
 
+    /*
+     * If no affine constraints are present we skip the intermediate
+     * (Trilinos or deal.II) sparse matrices entirely and scatter cell
+     * contributions directly into the SIMD matrices. Otherwise, we have
+     * to resolve constraints with AffineConstraints and read in the
+     * assembled matrices afterwards.
+     */
+    const bool assemble_directly =
+        assemble_directly_ &&
+        !Utilities::MPI::logical_or(affine_constraints_.n_constraints() > 0,
+                                    mpi_communicator_);
+
+    /* The intermediate sparsity pattern is still needed for dG: */
+    const bool need_sparsity_pattern =
+        !assemble_directly || discretization_->have_discontinuous_ansatz();
+
+    Assert(sparsity_pattern_.n_rows() == dof_handler.n_dofs(),
+           ExcMessage("The sparsity pattern has already been released. "
+                      "OfflineData::setup() has to be called before "
+                      "OfflineData::assemble()."));
+
+    /*
+     * The dynamic sparsity pattern is a per-row set structure that is
+     * considerably larger than the SIMD sparsity pattern. It is not
+     * needed any more once the (optional) intermediate sparsity pattern
+     * for assembly has been created. Release it before allocating the
+     * assembly matrices to also lower the peak memory footprint:
+     */
+    released_sparsity_pattern_memory_ = 0;
+    const auto release_sparsity_pattern = [&]() {
+      if (!release_sparsity_pattern_)
+        return;
+      released_sparsity_pattern_memory_ =
+          sparsity_pattern_.memory_consumption();
+      sparsity_pattern_.reinit(0, 0);
+    };
+
 #ifdef DEAL_II_WITH_TRILINOS
     /* Variant using TrilinosWrappers::SparseMatrix with global numbering */
 
@@ -445,19 +520,23 @@ namespace ryujin
 
     const IndexSet &locally_owned = dof_handler.locally_owned_dofs();
     TrilinosWrappers::SparsityPattern trilinos_sparsity_pattern;
-    trilinos_sparsity_pattern.reinit(
-        locally_owned, sparsity_pattern_, mpi_communicator_);
+    if (need_sparsity_pattern)
+      trilinos_sparsity_pattern.reinit(
+          locally_owned, sparsity_pattern_, mpi_communicator_);
+    release_sparsity_pattern();
 
     TrilinosWrappers::SparseMatrix mass_matrix_tmp;
     TrilinosWrappers::SparseMatrix mass_matrix_inverse_tmp;
-    if (discretization_->have_discontinuous_ansatz())
-      mass_matrix_inverse_tmp.reinit(trilinos_sparsity_pattern);
-
     std::array<TrilinosWrappers::SparseMatrix, dim> cij_matrix_tmp;
 
-    mass_matrix_tmp.reinit(trilinos_sparsity_pattern);
-    for (auto &matrix : cij_matrix_tmp)
-      matrix.reinit(trilinos_sparsity_pattern);
+    if (!assemble_directly) {
+      if (discretization_->have_discontinuous_ansatz())
+        mass_matrix_inverse_tmp.reinit(trilinos_sparsity_pattern);
+
+      mass_matrix_tmp.reinit(trilinos_sparsity_pattern);
+      for (auto &matrix : cij_matrix_tmp)
+        matrix.reinit(trilinos_sparsity_pattern);
+    }
 
 #else
     /* Variant using deal.II SparseMatrix with local numbering */
@@ -467,7 +546,7 @@ namespace ryujin
     transform_to_local_range(*scalar_partitioner_, affine_constraints_assembly);
 
     SparsityPattern sparsity_pattern_assembly;
-    {
+    if (need_sparsity_pattern) {
       DynamicSparsityPattern dsp(n_locally_relevant_, n_locally_relevant_);
       for (const auto &entry : sparsity_pattern_) {
         const auto i = scalar_partitioner_->global_to_local(entry.row());
@@ -476,17 +555,20 @@ namespace ryujin
       }
       sparsity_pattern_assembly.copy_from(dsp);
     }
+    release_sparsity_pattern();
 
     dealii::SparseMatrix<Number> mass_matrix_tmp;
     dealii::SparseMatrix<Number> mass_matrix_inverse_tmp;
-    if (discretization_->have_discontinuous_ansatz())
-      mass_matrix_inverse_tmp.reinit(sparsity_pattern_assembly);
-
     std::array<dealii::SparseMatrix<Number>, dim> cij_matrix_tmp;
 
-    mass_matrix_tmp.reinit(sparsity_pattern_assembly);
-    for (auto &matrix : cij_matrix_tmp)
-      matrix.reinit(sparsity_pattern_assembly);
+    if (!assemble_directly) {
+      if (discretization_->have_discontinuous_ansatz())
+        mass_matrix_inverse_tmp.reinit(sparsity_pattern_assembly);
+
+      mass_matrix_tmp.reinit(sparsity_pattern_assembly);
+      for (auto &matrix : cij_matrix_tmp)
+        matrix.reinit(sparsity_pattern_assembly);
+    }
 #endif
 
     const unsigned int dofs_per_cell =
@@ -523,7 +605,14 @@ namespace ryujin
       auto &fe_neighbor_face_values = scratch.fe_neighbor_face_values_;
 
 #ifdef DEAL_II_WITH_TRILINOS
-      is_locally_owned = cell->is_locally_owned();
+      /*
+       * When assembling directly into the SIMD matrices we do not have a
+       * compress(VectorOperation::add) available. In this case we
+       * assemble contributions over all locally relevant (non
+       * artificial) cells.
+       */
+      is_locally_owned =
+          assemble_directly ? !cell->is_artificial() : cell->is_locally_owned();
 #else
       /*
        * When using a local dealii::SparseMatrix<Number> we don not
@@ -678,8 +767,130 @@ namespace ryujin
       }
     };
 
+    /*
+     * Scatter cell contributions directly into the SIMD matrices. We only
+     * write to locally owned rows; ghost rows are exchanged afterwards.
+     * The position of every coupling (i, j) within the SIMD row is looked
+     * up once per cell and reused for all matrices.
+     */
+
+    std::vector<unsigned int> positions;
+
+    const auto find_positions = [&](const auto &row_indices,
+                                    const auto &column_indices) {
+      const auto &sparsity_simd = sparsity_pattern_simd_;
+      const auto n_columns = column_indices.size();
+      positions.resize(row_indices.size() * n_columns);
+
+      for (unsigned int i = 0; i < row_indices.size(); ++i) {
+        const auto row = row_indices[i];
+        if (row >= n_locally_owned_)
+          continue;
+
+        const unsigned int stride = sparsity_simd.stride_of_row(row);
+        const unsigned int row_length = sparsity_simd.row_length(row);
+        const unsigned int *js = sparsity_simd.columns(row);
+
+        /*
+         * The diagonal entry is stored first, all other column indices of
+         * the row are sorted in ascending order. We can thus look up
+         * positions with a binary search:
+         */
+        for (unsigned int j = 0; j < n_columns; ++j) {
+          const auto column = column_indices[j];
+          unsigned int col_idx = 0;
+          if (column != row) {
+            unsigned int first = 1;
+            unsigned int last = row_length;
+            while (first < last) {
+              const unsigned int middle = first + (last - first) / 2;
+              if (js[middle * stride] < column)
+                first = middle + 1;
+              else
+                last = middle;
+            }
+            col_idx = first;
+          }
+          Assert(col_idx < row_length && js[col_idx * stride] == column,
+                 ExcInternalError());
+          positions[i * n_columns + j] = col_idx;
+        }
+      }
+    };
+
+    const auto scatter_local_to_global = [&](const auto &copy) {
+      auto local_dof_indices = copy.local_dof_indices_;
+      auto neighbor_local_dof_indices = copy.neighbor_local_dof_indices_;
+      transform_to_local_range(*scalar_partitioner_, local_dof_indices);
+      for (auto &indices : neighbor_local_dof_indices)
+        transform_to_local_range(*scalar_partitioner_, indices);
+
+      const auto &cell_mass_matrix = copy.cell_mass_matrix_;
+      const auto &cell_mass_matrix_inverse = copy.cell_mass_matrix_inverse_;
+      const auto &cell_cij_matrix = copy.cell_cij_matrix_;
+      const auto &interface_cij_matrix = copy.interface_cij_matrix_;
+
+      find_positions(local_dof_indices, local_dof_indices);
+
+      for (unsigned int i = 0; i < dofs_per_cell; ++i) {
+        const auto row = local_dof_indices[i];
+        if (row >= n_locally_owned_)
+          continue;
+
+        for (unsigned int j = 0; j < dofs_per_cell; ++j) {
+          const auto col_idx = positions[i * dofs_per_cell + j];
+
+          const auto m_ij = mass_matrix_.get_entry(row, col_idx);
+          mass_matrix_.write_entry(
+              m_ij + Number(cell_mass_matrix(i, j)), row, col_idx);
+
+          auto c_ij = cij_matrix_.get_tensor(row, col_idx);
+          for (unsigned int d = 0; d < dim; ++d)
+            c_ij[d] += Number(cell_cij_matrix[d](i, j));
+          cij_matrix_.write_entry(c_ij, row, col_idx);
+
+          if (discretization_->have_discontinuous_ansatz()) {
+            const auto b_ij = mass_matrix_inverse_.get_entry(row, col_idx);
+            mass_matrix_inverse_.write_entry(
+                b_ij + Number(cell_mass_matrix_inverse(i, j)), row, col_idx);
+          }
+        }
+      }
+
+      for (unsigned int f_index = 0; f_index < copy.n_faces; ++f_index) {
+        const auto &neighbor_indices = neighbor_local_dof_indices[f_index];
+        if (neighbor_indices.size() == 0)
+          continue;
+
+        find_positions(local_dof_indices, neighbor_indices);
+
+        for (unsigned int i = 0; i < dofs_per_cell; ++i) {
+          const auto row = local_dof_indices[i];
+          if (row >= n_locally_owned_)
+            continue;
+
+          for (unsigned int j = 0; j < dofs_per_cell; ++j) {
+            const auto col_idx = positions[i * dofs_per_cell + j];
+            auto c_ij = cij_matrix_.get_tensor(row, col_idx);
+            for (unsigned int d = 0; d < dim; ++d)
+              c_ij[d] += Number(interface_cij_matrix[f_index][d](i, j));
+            cij_matrix_.write_entry(c_ij, row, col_idx);
+          }
+        }
+      }
+    };
+
     const auto copy_local_to_global = [&](const auto &copy) {
       const auto &is_locally_owned = copy.is_locally_owned_;
+
+      if (assemble_directly) {
+        if (is_locally_owned) {
+          scatter_local_to_global(copy);
+          measure_of_omega_ += copy.cell_measure_;
+        }
+        return;
+      }
+
 #ifdef DEAL_II_WITH_TRILINOS
       const auto &local_dof_indices = copy.local_dof_indices_;
       const auto &neighbor_local_dof_indices = copy.neighbor_local_dof_indices_;
@@ -745,21 +956,23 @@ namespace ryujin
                     AssemblyCopyData<dim, Number>());
 #endif
 
+    if (!assemble_directly) {
 #ifdef DEAL_II_WITH_TRILINOS
-    mass_matrix_tmp.compress(VectorOperation::add);
-    for (auto &it : cij_matrix_tmp)
-      it.compress(VectorOperation::add);
+      mass_matrix_tmp.compress(VectorOperation::add);
+      for (auto &it : cij_matrix_tmp)
+        it.compress(VectorOperation::add);
 
-    mass_matrix_.read_in(mass_matrix_tmp, /*locally_indexed*/ false);
-    if (discretization_->have_discontinuous_ansatz())
-      mass_matrix_inverse_.read_in(mass_matrix_inverse_tmp, /*loc_ind*/ false);
-    cij_matrix_.read_in(cij_matrix_tmp, /*locally_indexed*/ false);
+      mass_matrix_.read_in(mass_matrix_tmp, /*locally_indexed*/ false);
+      if (discretization_->have_discontinuous_ansatz())
+        mass_matrix_inverse_.read_in(mass_matrix_inverse_tmp, /*l_i*/ false);
+      cij_matrix_.read_in(cij_matrix_tmp, /*locally_indexed*/ false);
 #else
-    mass_matrix_.read_in(mass_matrix_tmp, /*locally_indexed*/ true);
-    if (discretization_->have_discontinuous_ansatz())
-      mass_matrix_inverse_.read_in(mass_matrix_inverse_tmp, /*loc_ind*/ true);
-    cij_matrix_.read_in(cij_matrix_tmp, /*locally_indexed*/ true);
+      mass_matrix_.read_in(mass_matrix_tmp, /*locally_indexed*/ true);
+      if (discretization_->have_discontinuous_ansatz())
+        mass_matrix_inverse_.read_in(mass_matrix_inverse_tmp, /*l_i*/ true);
+      cij_matrix_.read_in(cij_matrix_tmp, /*locally_indexed*/ true);
 #endif
+    }
 
     mass_matrix_.update_ghost_rows();
     if (discretization_->have_discontinuous_ansatz())
@@ -773,7 +986,21 @@ namespace ryujin
      * Create lumped mass matrix:
      */
 
-    {
+    if (assemble_directly) {
+      /* Without constraints the lumped mass matrix is the row sum: */
+      const auto &sparsity_simd = sparsity_pattern_simd_;
+      for (unsigned int i = 0; i < n_locally_owned_; ++i) {
+        Number m_i = 0.;
+        for (unsigned int col_idx = 0; col_idx < sparsity_simd.row_length(i);
+             ++col_idx)
+          m_i += mass_matrix_.get_entry(i, col_idx);
+        lumped_mass_matrix_.local_element(i) = m_i;
+        lumped_mass_matrix_inverse_.local_element(i) = 1. / m_i;
+      }
+      lumped_mass_matrix_.update_ghost_values();
+      lumped_mass_matrix_inverse_.update_ghost_values();
+
+    } else {
 #ifdef DEAL_II_WITH_TRILINOS
       ScalarVector one(scalar_partitioner_);
       one = 1.;
@@ -1002,6 +1229,8 @@ namespace ryujin
       boundary_map_ = construct_boundary_map(
           dof_handler.begin_active(), dof_handler.end(), *scalar_partitioner_);
 
+      boundary_map_soa_ = construct_boundary_map_soa(boundary_map_);
+
       coupling_boundary_pairs_ = collect_coupling_boundary_pairs(
           dof_handler.begin_active(), dof_handler.end(), *scalar_partitioner_);
     }
@@ -1102,6 +1331,43 @@ namespace ryujin
       Assert(sum.norm() < 1.e-12, dealii::ExcInternalError());
     }
 #endif
+
+#ifdef ANTISYMMETRIC_CIJ_STORAGE
+    /*
+     * Convert the c_ij matrix into antisymmetric storage and release the
+     * fully assembled matrix:
+     */
+    cij_matrix_antisymmetric_.reinit(cij_matrix_);
+    cij_matrix_ = SparseMatrixSIMD<Number, dim>();
+#endif
+
+#ifdef COMPRESSED_OFFLINE_DATA
+    /*
+     * Convert the mass, c_ij, and incidence matrices into a table of
+     * distinct stencils. The stencil matrices take over the fully
+     * assembled matrices and keep them if the stencil table does not
+     * reduce the memory footprint:
+     */
+    mass_matrix_stencil_.reinit(std::move(mass_matrix_));
+    bool compressed = mass_matrix_stencil_.compressed();
+#ifndef ANTISYMMETRIC_CIJ_STORAGE
+    cij_matrix_stencil_.reinit(std::move(cij_matrix_));
+    compressed &= cij_matrix_stencil_.compressed();
+#endif
+    if (discretization_->have_discontinuous_ansatz()) {
+      incidence_matrix_stencil_.reinit(std::move(incidence_matrix_));
+      compressed &= incidence_matrix_stencil_.compressed();
+    }
+
+    compressed = Utilities::MPI::min(static_cast<unsigned int>(compressed),
+                                     mpi_communicator_) == 1;
+    if (!compressed &&
+        Utilities::MPI::this_mpi_process(mpi_communicator_) == 0)
+      std::cerr << "Warning: COMPRESSED_OFFLINE_DATA is set but the offline "
+                   "data does not compress into a small number of "
+                   "stencils (is the mesh non-affine?). Falling back to the "
+                   "fully assembled matrices." << std::endl;
+#endif
   }
 
 
@@ -1366,6 +1632,78 @@ namespace ryujin
   }
 
 
+  template <int dim, typename Number>
+  auto OfflineData<dim, Number>::construct_boundary_map_soa(
+      const BoundaryMap &boundary_map) const -> BoundaryMapSoA
+  {
+#ifdef DEBUG_OUTPUT
+    std::cout << "OfflineData<dim, Number>::construct_boundary_map_soa()"
+              << std::endl;
+#endif
+
+    /*
+     * Assign every entry to a layer: The boundary map is sorted by dof
+     * index, so the k-th entry of a given degree of freedom simply goes
+     * into layer k. This preserves the order in which multiple boundary
+     * conditions of the same degree of freedom are applied.
+     */
+
+    std::vector<std::tuple<unsigned int /*layer*/,
+                           dealii::types::boundary_id /*id*/,
+                           unsigned int /*i*/,
+                           unsigned int /*entry*/>>
+        keys;
+    keys.reserve(boundary_map.size());
+
+    unsigned int layer = 0;
+    for (unsigned int k = 0; k < boundary_map.size(); ++k) {
+      const auto &[i, normal, normal_mass, boundary_mass, id, position] =
+          boundary_map[k];
+
+      if (k > 0 && std::get<0>(boundary_map[k - 1]) == i)
+        layer++;
+      else
+        layer = 0;
+
+      if (id == Boundary::do_nothing)
+        continue;
+
+      keys.push_back({layer, id, i, k});
+    }
+
+    std::sort(keys.begin(), keys.end());
+
+    /*
+     * And populate the structure of arrays:
+     */
+
+    BoundaryMapSoA boundary_map_soa;
+    const auto n_entries = keys.size();
+    boundary_map_soa.i.resize(n_entries);
+    boundary_map_soa.normal.resize(n_entries);
+    boundary_map_soa.id.resize(n_entries);
+    boundary_map_soa.position.resize(n_entries);
+    boundary_map_soa.layer_starts.push_back(0);
+
+    for (unsigned int k = 0; k < n_entries; ++k) {
+      const auto &[layer, id, i, entry] = keys[k];
+
+      /* Note that a layer might be empty: */
+      while (layer >= boundary_map_soa.layer_starts.size())
+        boundary_map_soa.layer_starts.push_back(k);
+
+      boundary_map_soa.i[k] = i;
+      boundary_map_soa.normal[k] = std::get<1>(boundary_map[entry]);
+      boundary_map_soa.id[k] = id;
+      boundary_map_soa.position[k] = std::get<5>(boundary_map[entry]);
+    }
+
+    boundary_map_soa.layer_starts.push_back(n_entries);
+
+    return boundary_map_soa;
+  }
+
+
   template <int dim, typename Number>
   template <typename ITERATOR1, typename ITERATOR2>
   auto OfflineData<dim, Number>::collect_coupling_boundary_pairs(
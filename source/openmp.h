@@ -7,14 +7,22 @@
 
 #include <compile_time_options.h>
 
+#include <deal.II/base/aligned_vector.h>
 #include <deal.II/base/config.h>
 
 #ifdef WITH_OPENMP
 #include <omp.h>
 #endif
 
+#ifdef TRANSPARENT_HUGE_PAGES
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 #include <atomic>
+#include <cstdint>
 #include <future>
+#include <type_traits>
 
 /**
  * @name OpenMP parallel for macros
@@ -134,7 +142,13 @@
 namespace ryujin
 {
   /**
-   * @todo write documentation
+   * A small helper class that overlaps an (MPI) communication payload
+   * with thread-parallel work. Every thread of the enclosing parallel
+   * region calls check() once it has finished all work that the payload
+   * depends on. As soon as the last thread has signalled readiness the
+   * payload is launched asynchronously. The destructor waits for the
+   * payload to finish, or executes it if it has not been launched (for
+   * example, if ASYNC_MPI_EXCHANGE is not set).
    *
    * @ingroup Miscellaneous
    */
@@ -180,6 +194,42 @@ namespace ryujin
     std::future<void> payload_status_;
     std::atomic_int n_threads_ready_;
   };
+
+
+  /**
+   * Resize @p vector to @p size elements without initializing newly
+   * allocated memory. Memory pages are thus only placed on a NUMA domain
+   * once they are first touched. The caller is expected to initialize
+   * the vector in a parallel region with the same static distribution
+   * of work (i.e., the same RYUJIN_OMP_FOR loop bounds) as used in the
+   * compute loops accessing the vector.
+   *
+   * If TRANSPARENT_HUGE_PAGES is set we additionally advise the kernel
+   * to back the memory with transparent huge pages.
+   *
+   * @ingroup Miscellaneous
+   */
+  template <typename T>
+  void resize_for_first_touch(dealii::AlignedVector<T> &vector,
+                              const std::size_t size)
+  {
+    static_assert(std::is_trivial_v<T>,
+                  "resize_fast() only skips initialization for trivial "
+                  "types");
+
+    vector.resize_fast(size);
+
+#if defined(TRANSPARENT_HUGE_PAGES) && defined(MADV_HUGEPAGE)
+    const std::uintptr_t page_size = sysconf(_SC_PAGESIZE);
+    const auto begin = reinterpret_cast<std::uintptr_t>(vector.data());
+    const auto end = begin + size * sizeof(T);
+    const auto aligned_begin = (begin + page_size - 1) / page_size * page_size;
+    if (end > aligned_begin + page_size)
+      madvise(reinterpret_cast<void *>(aligned_begin),
+              (end - aligned_begin) / page_size * page_size,
+              MADV_HUGEPAGE);
+#endif
+  }
 } // namespace ryujin
 
 //@}
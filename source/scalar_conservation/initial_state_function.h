@@ -10,6 +10,8 @@
 
 #include <deal.II/base/function_parser.h>
 
+#include <mutex>
+
 namespace ryujin
 {
   namespace ScalarConservation
@@ -58,6 +60,9 @@ namespace ryujin
 
       state_type compute(const dealii::Point<dim> &point, Number t) final
       {
+        /* set_time() modifies the shared function parser object: */
+        std::lock_guard<std::mutex> lock(mutex_);
+
         function_->set_time(t);
         state_type result;
         result[0] = function_->value(point);
@@ -69,6 +74,8 @@ namespace ryujin
 
       std::string expression_;
       std::unique_ptr<dealii::FunctionParser<dim>> function_;
+
+      std::mutex mutex_;
     };
   } // namespace ScalarConservation
 } // namespace ryujin
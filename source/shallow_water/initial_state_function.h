@@ -11,6 +11,8 @@
 
 #include <deal.II/base/function_parser.h>
 
+#include <mutex>
+
 namespace ryujin
 {
   namespace ShallowWaterInitialStates
@@ -79,6 +81,9 @@ namespace ryujin
 
       state_type compute(const dealii::Point<dim> &point, Number t) final
       {
+        /* set_time() modifies the shared function parser objects: */
+        std::lock_guard<std::mutex> lock(mutex_);
+
         const auto view = hyperbolic_system_.template view<dim, Number>();
         state_type full_primitive;
 
@@ -108,6 +113,8 @@ namespace ryujin
       std::unique_ptr<dealii::FunctionParser<dim>> velocity_x_function_;
       std::unique_ptr<dealii::FunctionParser<dim>> velocity_y_function_;
       std::unique_ptr<dealii::FunctionParser<dim>> bathymetry_function_;
+
+      std::mutex mutex_;
     };
   } // namespace ShallowWaterInitialStates
 } // namespace ryujin
\ No newline at end of file
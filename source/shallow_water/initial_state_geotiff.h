@@ -10,6 +10,8 @@
 
 #include <deal.II/base/function_parser.h>
 
+#include <mutex>
+
 
 #ifdef WITH_GDAL
 #include <cpl_conv.h>
@@ -118,6 +120,9 @@ namespace ryujin
       {
         const auto z = compute_bathymetry(point);
 
+        /* set_time() modifies the shared function parser objects: */
+        std::lock_guard<std::mutex> lock(mutex_);
+
         dealii::Tensor<1, 2, Number> primitive;
 
         height_function_->set_time(t);
@@ -392,6 +397,8 @@ namespace ryujin
 
       std::unique_ptr<dealii::FunctionParser<dim>> height_function_;
       std::unique_ptr<dealii::FunctionParser<dim>> velocity_function_;
+
+      std::mutex mutex_;
     };
   } // namespace ShallowWaterInitialStates
 } // namespace ryujin
@@ -0,0 +1,346 @@
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright (C) 2024 by the ryujin authors
+//
+
+#pragma once
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/mpi.h>
+
+#include <numeric>
+#include <vector>
+
+namespace ryujin
+{
+  /**
+   * A node-local MPI communicator. reinit() splits a given communicator
+   * into node-local communicators and records for every MPI rank of the
+   * given communicator the corresponding node-local rank. Splitting is
+   * skipped if reinit() is called again with the same communicator.
+   *
+   * The class cannot be copied, moving transfers ownership.
+   *
+   * @note reinit() is collective over all MPI ranks of the given
+   * communicator, clear() (and thus the destructor) is collective over
+   * all MPI ranks of the node-local communicator.
+   */
+  class NodeCommunicator
+  {
+  public:
+    NodeCommunicator() = default;
+
+    NodeCommunicator(const NodeCommunicator &) = delete;
+
+    NodeCommunicator(NodeCommunicator &&other) noexcept
+    {
+      swap(other);
+    }
+
+    NodeCommunicator &operator=(const NodeCommunicator &) = delete;
+
+    NodeCommunicator &operator=(NodeCommunicator &&other) noexcept
+    {
+      if (this != &other) {
+        clear();
+        swap(other);
+      }
+      return *this;
+    }
+
+    ~NodeCommunicator()
+    {
+      clear();
+    }
+
+    /**
+     * Split the given @p communicator into node-local communicators.
+     */
+    void reinit(const MPI_Comm &communicator);
+
+    /**
+     * Free the node-local communicator.
+     */
+    void clear();
+
+    /**
+     * Return whether the node-local communicator has been set up.
+     */
+    bool valid() const
+    {
+      return node_communicator_ != MPI_COMM_NULL;
+    }
+
+    /**
+     * Return the node-local communicator.
+     */
+    const MPI_Comm &communicator() const
+    {
+      return node_communicator_;
+    }
+
+    /**
+     * Return the rank within the node-local communicator for a given
+     * @p rank of the communicator used in reinit(), or -1 if the MPI rank
+     * does not reside on the same node.
+     */
+    int shared_rank(const unsigned int rank) const
+    {
+      if (rank >= shared_ranks_.size())
+        return -1;
+      return shared_ranks_[rank];
+    }
+
+  private:
+    void swap(NodeCommunicator &other)
+    {
+      std::swap(communicator_, other.communicator_);
+      std::swap(node_communicator_, other.node_communicator_);
+      shared_ranks_.swap(other.shared_ranks_);
+    }
+
+    MPI_Comm communicator_ = MPI_COMM_NULL;
+    MPI_Comm node_communicator_ = MPI_COMM_NULL;
+    std::vector<int> shared_ranks_;
+  };
+
+
+  /**
+   * A node-local MPI-3 shared memory window. reinit() allocates a shared
+   * memory segment of given size on every MPI rank of a node-local
+   * communicator. The segments of all other MPI ranks on the same node
+   * can then be accessed directly with memory().
+   *
+   * The class cannot be copied (a copy would have to allocate a new
+   * window collectively), moving transfers ownership.
+   *
+   * @note reinit() and clear() (and thus the destructor) are collective
+   * over all MPI ranks of the node-local communicator.
+   */
+  class SharedMemoryWindow
+  {
+  public:
+    SharedMemoryWindow() = default;
+
+    SharedMemoryWindow(const SharedMemoryWindow &) = delete;
+
+    SharedMemoryWindow(SharedMemoryWindow &&other) noexcept
+    {
+      swap(other);
+    }
+
+    SharedMemoryWindow &operator=(const SharedMemoryWindow &) = delete;
+
+    SharedMemoryWindow &operator=(SharedMemoryWindow &&other) noexcept
+    {
+      if (this != &other) {
+        clear();
+        swap(other);
+      }
+      return *this;
+    }
+
+    ~SharedMemoryWindow()
+    {
+      clear();
+    }
+
+    /**
+     * Allocate a shared memory segment of @p size bytes for every MPI
+     * rank of the given @p node_communicator. All MPI ranks of the
+     * communicator must reside on the same node, see NodeCommunicator.
+     */
+    void reinit(const MPI_Comm &node_communicator, const std::size_t size);
+
+    /**
+     * Free the shared memory window.
+     */
+    void clear();
+
+    /**
+     * Return whether the window has been set up.
+     */
+    bool valid() const
+    {
+      return !base_pointers_.empty();
+    }
+
+    /**
+     * Return a pointer to the shared memory segment of the MPI rank with
+     * node-local rank @p shared_rank.
+     */
+    char *memory(const int shared_rank) const
+    {
+      AssertIndexRange(shared_rank, base_pointers_.size());
+      return base_pointers_[shared_rank];
+    }
+
+    /**
+     * Return a pointer to the shared memory segment of this MPI rank.
+     */
+    char *local_memory() const
+    {
+      return memory(this_shared_rank_);
+    }
+
+    /**
+     * Synchronize the private and public copy of the window, i.e., make
+     * local stores visible to (and remote stores visible from) other
+     * MPI ranks on the same node.
+     */
+    void sync() const;
+
+  private:
+    void swap(SharedMemoryWindow &other)
+    {
+      std::swap(window_, other.window_);
+      std::swap(this_shared_rank_, other.this_shared_rank_);
+      base_pointers_.swap(other.base_pointers_);
+    }
+
+    MPI_Win window_ = MPI_WIN_NULL;
+    int this_shared_rank_ = 0;
+    std::vector<char *> base_pointers_;
+  };
+
+
+  inline void NodeCommunicator::reinit(const MPI_Comm &communicator)
+  {
+    if (valid() && communicator == communicator_)
+      return;
+
+    clear();
+
+#ifdef DEAL_II_WITH_MPI
+    int ierr = MPI_Comm_split_type(communicator,
+                                   MPI_COMM_TYPE_SHARED,
+                                   0,
+                                   MPI_INFO_NULL,
+                                   &node_communicator_);
+    AssertThrowMPI(ierr);
+
+    communicator_ = communicator;
+
+    /* Translate ranks of the communicator into node-local ranks: */
+
+    int n_ranks;
+    ierr = MPI_Comm_size(communicator, &n_ranks);
+    AssertThrowMPI(ierr);
+
+    std::vector<int> ranks(n_ranks);
+    std::iota(ranks.begin(), ranks.end(), 0);
+    shared_ranks_.resize(n_ranks);
+
+    MPI_Group group, shared_group;
+    ierr = MPI_Comm_group(communicator, &group);
+    AssertThrowMPI(ierr);
+    ierr = MPI_Comm_group(node_communicator_, &shared_group);
+    AssertThrowMPI(ierr);
+    ierr = MPI_Group_translate_ranks(
+        group, n_ranks, ranks.data(), shared_group, shared_ranks_.data());
+    AssertThrowMPI(ierr);
+    MPI_Group_free(&group);
+    MPI_Group_free(&shared_group);
+
+    for (auto &it : shared_ranks_)
+      if (it == MPI_UNDEFINED)
+        it = -1;
+#else
+    (void)communicator;
+#endif
+  }
+
+
+  inline void NodeCommunicator::clear()
+  {
+#ifdef DEAL_II_WITH_MPI
+    int finalized = 0;
+    MPI_Finalized(&finalized);
+
+    if (!finalized && node_communicator_ != MPI_COMM_NULL)
+      MPI_Comm_free(&node_communicator_);
+#endif
+
+    communicator_ = MPI_COMM_NULL;
+    node_communicator_ = MPI_COMM_NULL;
+    shared_ranks_.clear();
+  }
+
+
+  inline void SharedMemoryWindow::reinit(const MPI_Comm &node_communicator,
+                                         const std::size_t size)
+  {
+    clear();
+
+#ifdef DEAL_II_WITH_MPI
+    int ierr = MPI_Comm_rank(node_communicator, &this_shared_rank_);
+    AssertThrowMPI(ierr);
+
+    int n_shared_ranks;
+    ierr = MPI_Comm_size(node_communicator, &n_shared_ranks);
+    AssertThrowMPI(ierr);
+
+    MPI_Info info;
+    ierr = MPI_Info_create(&info);
+    AssertThrowMPI(ierr);
+    ierr = MPI_Info_set(info, "alloc_shared_noncontig", "true");
+    AssertThrowMPI(ierr);
+
+    void *base_pointer;
+    ierr = MPI_Win_allocate_shared(
+        size, 1, info, node_communicator, &base_pointer, &window_);
+    AssertThrowMPI(ierr);
+
+    ierr = MPI_Info_free(&info);
+    AssertThrowMPI(ierr);
+
+    /* Keep a passive target access epoch open for the lifetime: */
+    ierr = MPI_Win_lock_all(MPI_MODE_NOCHECK, window_);
+    AssertThrowMPI(ierr);
+
+    base_pointers_.resize(n_shared_ranks);
+    for (int r = 0; r < n_shared_ranks; ++r) {
+      MPI_Aint segment_size;
+      int displacement_unit;
+      ierr = MPI_Win_shared_query(window_,
+                                  r,
+                                  &segment_size,
+                                  &displacement_unit,
+                                  &base_pointers_[r]);
+      AssertThrowMPI(ierr);
+    }
+#else
+    (void)node_communicator;
+    (void)size;
+#endif
+  }
+
+
+  inline void SharedMemoryWindow::clear()
+  {
+#ifdef DEAL_II_WITH_MPI
+    int finalized = 0;
+    MPI_Finalized(&finalized);
+
+    if (!finalized && window_ != MPI_WIN_NULL) {
+      MPI_Win_unlock_all(window_);
+      MPI_Win_free(&window_);
+    }
+#endif
+
+    window_ = MPI_WIN_NULL;
+    this_shared_rank_ = 0;
+    base_pointers_.clear();
+  }
+
+
+  inline void SharedMemoryWindow::sync() const
+  {
+#ifdef DEAL_II_WITH_MPI
+    if (window_ != MPI_WIN_NULL) {
+      const int ierr = MPI_Win_sync(window_);
+      AssertThrowMPI(ierr);
+    }
+#endif
+  }
+} // namespace ryujin
@@ -13,7 +13,17 @@ namespace ryujin
 
   template class SparsityPatternSIMD<dealii::VectorizedArray<NUMBER>::size()>;
 
+  template class EdgeListSIMD<dealii::VectorizedArray<NUMBER>::size()>;
+
   template class SparseMatrixSIMD<NUMBER, 1>;
   template class SparseMatrixSIMD<NUMBER, 2>;
   template class SparseMatrixSIMD<NUMBER, 3>;
+
+  template class AntisymmetricSparseMatrixSIMD<NUMBER, 1>;
+  template class AntisymmetricSparseMatrixSIMD<NUMBER, 2>;
+  template class AntisymmetricSparseMatrixSIMD<NUMBER, 3>;
+
+  template class StencilSparseMatrixSIMD<NUMBER, 1>;
+  template class StencilSparseMatrixSIMD<NUMBER, 2>;
+  template class StencilSparseMatrixSIMD<NUMBER, 3>;
 } /* namespace ryujin */
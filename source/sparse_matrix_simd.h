@@ -10,8 +10,13 @@
 #include <deal.II/lac/dynamic_sparsity_pattern.h>
 
 #include "openmp.h"
+#include "shared_memory_window.h"
 #include "simd.h"
 
+#include <cstdint>
+#include <map>
+#include <vector>
+
 namespace ryujin
 {
   namespace
@@ -29,6 +34,18 @@ namespace ryujin
     struct EntryType<Number, 1> {
       using type = Number;
     };
+
+
+    /**
+     * Internally used: A small helper to determine whether the given type
+     * @p T is a VectorizedArray of width @p simd_length (with arbitrary
+     * underlying number type).
+     */
+    template <typename T, int simd_length>
+    constexpr bool is_vectorized_array_of_width = std::is_same_v<
+        T,
+        dealii::VectorizedArray<typename get_value_type<T>::type,
+                                simd_length>>;
   } // namespace
 
 
@@ -37,6 +54,16 @@ namespace ryujin
             int simd_length = dealii::VectorizedArray<Number>::size()>
   class SparseMatrixSIMD;
 
+  template <typename Number,
+            int n_components = 1,
+            int simd_length = dealii::VectorizedArray<Number>::size()>
+  class AntisymmetricSparseMatrixSIMD;
+
+  template <typename Number,
+            int n_components = 1,
+            int simd_length = dealii::VectorizedArray<Number>::size()>
+  class StencilSparseMatrixSIMD;
+
   /**
    * A specialized sparsity pattern for efficient vectorized SIMD access.
    *
@@ -97,21 +124,74 @@ namespace ryujin
      */
     unsigned int stride_of_row(const unsigned int row) const;
 
+    /**
+     * Return a pointer to the column indices of a given row. In the
+     * vectorized row index region [0, n_internal_dofs) consecutive column
+     * indices of the row are strided by simd_length.
+     *
+     * @note If COMPRESSED_COLUMN_INDICES is set, column indices are
+     * decoded into a thread-local buffer. The returned pointer is then
+     * only valid until the next call to columns() on the same thread.
+     */
     const unsigned int *columns(const unsigned int row) const;
 
+    /**
+     * Return the column index of the entry indexed by @p row and
+     * @p position_within_column.
+     */
+    unsigned int column(const unsigned int row,
+                        const unsigned int position_within_column) const;
+
     unsigned int row_length(const unsigned int row) const;
 
     unsigned int n_rows() const;
 
     std::size_t n_nonzero_elements() const;
 
+    /**
+     * Resize @p array to hold @p n_components values per nonzero entry
+     * and initialize it with zero in a parallel region. Rows are
+     * distributed over threads in the same way as in the compute loops of
+     * the HyperbolicModule (first [n_internal_dofs, n_locally_owned_dofs),
+     * then [0, n_export_indices) and [n_export_indices, n_internal_dofs),
+     * each with a static schedule), so that memory pages are placed on
+     * the NUMA domain of the thread that later works on them.
+     */
+    template <typename T>
+    void first_touch(dealii::AlignedVector<T> &array,
+                     const unsigned int n_components = 1) const;
+
   protected:
     unsigned int n_internal_dofs;
     unsigned int n_locally_owned_dofs;
+
+    /**
+     * The end of the range [0, n_export_indices) of internal rows that
+     * are exported to other MPI ranks, rounded up to simd_length. This
+     * matches OfflineData::n_export_indices().
+     */
+    unsigned int n_export_indices;
     std::shared_ptr<const dealii::Utilities::MPI::Partitioner> partitioner;
 
     dealii::AlignedVector<std::size_t> row_starts;
+#ifdef COMPRESSED_COLUMN_INDICES
+    /**
+     * Column indices stored as 16 bit offsets relative to the row index.
+     * The array has the same layout as the matrix data.
+     */
+    dealii::AlignedVector<std::int16_t> column_offsets;
+
+    /**
+     * For every (SIMD) row an offset into uncompressed_columns if one of
+     * the column offsets of the row does not fit into 16 bits (which
+     * typically happens for couplings to ghost indices), and
+     * numbers::invalid_unsigned_int otherwise.
+     */
+    dealii::AlignedVector<unsigned int> column_escapes;
+    dealii::AlignedVector<unsigned int> uncompressed_columns;
+#else
     dealii::AlignedVector<unsigned int> column_indices;
+#endif
     dealii::AlignedVector<unsigned int> indices_transposed;
 
     /**
@@ -141,10 +221,174 @@ namespace ryujin
      */
     std::vector<std::pair<unsigned int, unsigned int>> receive_targets;
 
+#ifdef SHARED_MEMORY_EXCHANGE
+    /**
+     * For every receive target the offset of the corresponding message
+     * within the entries_to_be_sent array of the sending MPI rank. This
+     * is used to read ghost rows directly from the exchange buffer of MPI
+     * ranks residing on the same node.
+     */
+    std::vector<unsigned int> receive_offsets;
+
+    /**
+     * The node-local communicator shared by all matrices using this
+     * sparsity pattern.
+     */
+    NodeCommunicator node_communicator;
+#endif
+
     MPI_Comm mpi_communicator;
 
     template <typename, int, int>
     friend class SparseMatrixSIMD;
+
+    template <typename, int, int>
+    friend class AntisymmetricSparseMatrixSIMD;
+
+    template <typename, int, int>
+    friend class StencilSparseMatrixSIMD;
+
+    template <int>
+    friend class EdgeListSIMD;
+  };
+
+
+  /**
+   * A list of all "edges" of a SparsityPatternSIMD, i.e., all index
+   * pairs (i,j) with j > i (in local numbering) and i locally owned.
+   * The edge list is used for computing symmetric graph quantities (such
+   * as the graph viscosity d_ij) exactly once per edge.
+   *
+   * For every (SIMD) row of the sparsity pattern we store the positions
+   * within the row (col_idx) of all entries that contain at least one
+   * edge. In the vectorized row index region [0, n_internal_dofs) such an
+   * "edge batch" groups simd_length rows. We thus additionally store a
+   * lane mask where bit k is set if the (i + k, js[k]) entry of the batch
+   * is an edge, i.e., js[k] > i + k. For the non-vectorized row index
+   * region [n_internal_dofs, n_locally_owned_dofs) the lane mask is always
+   * equal to 1.
+   *
+   * Edges are "owned" by the row with the lower index. The value of an
+   * edge is thus written to the (i,j) entry and the transposed (j,i)
+   * entry by the thread processing row i (see
+   * SparseMatrixSIMD::write_transposed_entry()). Because every matrix
+   * entry is written exactly once this owner-computes strategy is thread
+   * safe.
+   */
+  template <int simd_length>
+  class EdgeListSIMD
+  {
+  public:
+    /**
+     * Default constructor.
+     */
+    EdgeListSIMD();
+
+    /**
+     * Reinit function that (re)creates the edge list for a given
+     * SparsityPatternSIMD.
+     */
+    void reinit(const SparsityPatternSIMD<simd_length> &sparsity);
+
+    /**
+     * Return a pointer to the positions within the row (col_idx) of all
+     * edge batches of a given row.
+     */
+    const unsigned int *positions(const unsigned int row) const;
+
+    /**
+     * Return a pointer to the lane masks of all edge batches of a given
+     * row.
+     */
+    const unsigned int *lane_masks(const unsigned int row) const;
+
+    /**
+     * Return the number of edge batches of a given row.
+     */
+    unsigned int n_batches(const unsigned int row) const;
+
+    /**
+     * Return the total number of edges.
+     */
+    std::size_t n_edges() const;
+
+    /**
+     * The lane mask of an edge batch where every lane holds an edge.
+     */
+    static constexpr unsigned int full_mask = (1u << simd_length) - 1u;
+
+  protected:
+    unsigned int n_internal_dofs;
+
+    dealii::AlignedVector<std::size_t> row_starts;
+    dealii::AlignedVector<unsigned int> batch_positions;
+    dealii::AlignedVector<unsigned int> batch_lane_masks;
+
+    std::size_t n_edges_;
+  };
+
+
+  /**
+   * A small container holding sets of persistent MPI requests (created
+   * with MPI_Send_init() and MPI_Recv_init()) indexed by a communication
+   * channel. Persistent requests are bound to a fixed memory location.
+   * Copying a container therefore results in an empty container, and all
+   * requests are freed when the container is cleared or destroyed. Moving
+   * a container transfers ownership of the requests.
+   */
+  class PersistentMPIRequests
+  {
+  public:
+    PersistentMPIRequests() = default;
+
+    PersistentMPIRequests(const PersistentMPIRequests &)
+    {
+    }
+
+    PersistentMPIRequests(PersistentMPIRequests &&other) noexcept
+        : requests_(std::move(other.requests_))
+    {
+      other.requests_.clear();
+    }
+
+    PersistentMPIRequests &operator=(const PersistentMPIRequests &)
+    {
+      clear();
+      return *this;
+    }
+
+    PersistentMPIRequests &operator=(PersistentMPIRequests &&other) noexcept
+    {
+      if (this != &other) {
+        clear();
+        requests_ = std::move(other.requests_);
+        other.requests_.clear();
+      }
+      return *this;
+    }
+
+    ~PersistentMPIRequests()
+    {
+      clear();
+    }
+
+    /**
+     * Return the set of requests associated with the given communication
+     * channel. The returned vector is empty if no requests have been set
+     * up for the channel so far.
+     */
+    std::vector<MPI_Request> &operator[](const unsigned int channel)
+    {
+      return requests_[channel];
+    }
+
+    /**
+     * Free all persistent requests. None of the requests must be active.
+     */
+    void clear();
+
+  private:
+    std::map<unsigned int, std::vector<MPI_Request>> requests_;
   };
 
 
@@ -165,7 +409,24 @@ namespace ryujin
 
     SparseMatrixSIMD(const SparsityPatternSIMD<simd_length> &sparsity);
 
-    void reinit(const SparsityPatternSIMD<simd_length> &sparsity);
+    /**
+     * Reinitialize the matrix for a given sparsity pattern and set all
+     * entries to zero.
+     *
+     * If @p mirror_transposed is set to true the matrix additionally
+     * maintains a "transpose-mirrored" shadow copy of all entries: Every
+     * write_entry() also scatters the entry into the transposed position
+     * of the shadow array, and update_ghost_rows_finish() does the same
+     * for all received ghost rows. get_transposed_entry() then reads from
+     * the shadow array with the same (contiguous) access pattern as
+     * get_entry() instead of gathering through the transposed indices.
+     * This trades a read-side gather for a write-side scatter and twice
+     * the memory footprint. Only supported if `n_components` is equal to
+     * 1. Nota bene: write_transposed_entry() does not update the shadow
+     * array.
+     */
+    void reinit(const SparsityPatternSIMD<simd_length> &sparsity,
+                const bool mirror_transposed = false);
 
     template <typename SparseMatrix>
     void read_in(const std::array<SparseMatrix, n_components> &sparse_matrix,
@@ -288,6 +549,26 @@ namespace ryujin
                      const unsigned int position_within_column,
                      const bool do_streaming_store = false);
 
+    /* Write transposed scalar entry: */
+
+    /**
+     * Write a (scalar valued) @p entry to the transposed position of the
+     * matrix entry indexed by @p row and @p position_within_column. This
+     * is the counterpart to get_transposed_entry().
+     *
+     * @note If the template argument @a Number2
+     * is a vetorized array a specialized, faster access will be performed.
+     * In this case the index @p row must be within the interval
+     * [0, n_internal_dofs) and must be divisible by simd_length.
+     *
+     * @note This function is only available if `n_components` is equal to
+     * 1.
+     */
+    template <typename Number2 = Number>
+    void write_transposed_entry(const Number2 entry,
+                                const unsigned int row,
+                                const unsigned int position_within_column);
+
     /* Synchronize over MPI ranks: */
 
     void update_ghost_rows_start(const unsigned int communication_channel = 0);
@@ -300,102 +581,464 @@ namespace ryujin
     const SparsityPatternSIMD<simd_length> *sparsity;
     dealii::AlignedVector<Number> data;
     dealii::AlignedVector<Number> exchange_buffer;
-    std::vector<MPI_Request> requests;
-  };
 
-  /*
-   * Inline function  definitions:
-   */
+    /**
+     * Transpose-mirrored shadow copy of data, i.e., the entry stored at
+     * a given position is the entry at the transposed position of data.
+     * The array is empty unless the matrix has been initialized with
+     * mirror_transposed set to true.
+     */
+    dealii::AlignedVector<Number> transposed_data;
 
+    /**
+     * Persistent send and receive requests for the ghost row exchange,
+     * set up once per communication channel on first use and reused
+     * until the next call to reinit().
+     */
+    PersistentMPIRequests requests;
+    unsigned int active_channel;
 
-  template <int simd_length>
-  DEAL_II_ALWAYS_INLINE inline unsigned int
-  SparsityPatternSIMD<simd_length>::stride_of_row(const unsigned int row) const
-  {
-    AssertIndexRange(row, row_starts.size());
+#ifdef SHARED_MEMORY_EXCHANGE
+    /**
+     * Node-local shared memory window holding the exchange buffer. The
+     * window is allocated over the node-local communicator of the
+     * sparsity pattern. It cannot be copied, and neither can the matrix.
+     */
+    SharedMemoryWindow shared_window;
+#endif
 
-    if (row < n_internal_dofs)
-      return simd_length;
-    else
-      return 1;
-  }
+    template <typename, int, int>
+    friend class AntisymmetricSparseMatrixSIMD;
 
+    template <typename, int, int>
+    friend class StencilSparseMatrixSIMD;
+  };
 
-  template <int simd_length>
-  DEAL_II_ALWAYS_INLINE inline const unsigned int *
-  SparsityPatternSIMD<simd_length>::columns(const unsigned int row) const
-  {
-    AssertIndexRange(row, row_starts.size() - 1);
 
-    if (row < n_internal_dofs)
-      return column_indices.data() + row_starts[row / simd_length] +
-             row % simd_length;
-    else
-      return column_indices.data() + row_starts[row];
-  }
+  /**
+   * A read-only variant of SparseMatrixSIMD for matrices that are
+   * (mostly) antisymmetric, i.e., \f$m_{ji} = -m_{ij}\f$ for all but a
+   * few entries. An example is the \f$(c_{ij})\f$ matrix for which the
+   * identity only fails for pairs of boundary degrees of freedom.
+   *
+   * In the vectorized row index region [0, n_internal_dofs) we omit the
+   * longest leading block of positions within a SIMD row (excluding the
+   * diagonal at position 0) for which all entries reference a column
+   * j < i and satisfy \f$m_{ij} = -m_{ji}\f$. Such an omitted entry is
+   * reconstructed from its transposed counterpart, which is always
+   * stored, by a gather through a precomputed array of offsets. All
+   * other entries are stored in the same array-of-struct-of-array format
+   * as SparseMatrixSIMD. The non-vectorized row index region
+   * [n_internal_dofs, n_locally_relevant_dofs) is stored in full CSR
+   * format. For a typical (bandwidth reducing) numbering this roughly
+   * halves the memory footprint of the vectorized region.
+   *
+   * The matrix is initialized from a fully assembled SparseMatrixSIMD
+   * (including ghost rows) and cannot be modified afterwards.
+   */
+  template <typename Number, int n_components, int simd_length>
+  class AntisymmetricSparseMatrixSIMD
+  {
+  public:
+    AntisymmetricSparseMatrixSIMD();
 
+    /**
+     * Initialize the matrix from an assembled SparseMatrixSIMD @p matrix.
+     * An entry is considered antisymmetric if
+     * \f$|m_{ij} + m_{ji}| \le \text{tolerance}\,|m_{ij}|\f$.
+     */
+    void
+    reinit(const SparseMatrixSIMD<Number, n_components, simd_length> &matrix,
+           const Number tolerance = Number(1.0e-10));
 
-  template <int simd_length>
-  DEAL_II_ALWAYS_INLINE inline unsigned int
-  SparsityPatternSIMD<simd_length>::row_length(const unsigned int row) const
-  {
-    AssertIndexRange(row, row_starts.size() - 1);
+    using VectorizedArray = dealii::VectorizedArray<Number, simd_length>;
 
-    if (row < n_internal_dofs) {
-      const unsigned int simd_row = row / simd_length;
-      return (row_starts[simd_row + 1] - row_starts[simd_row]) / simd_length;
-    } else {
-      return row_starts[row + 1] - row_starts[row];
-    }
-  }
+    /**
+     * Return the tensor-valued entry indexed by @p row and
+     * @p position_within_column. See SparseMatrixSIMD::get_tensor().
+     */
+    template <typename Number2 = Number>
+    dealii::Tensor<1, n_components, Number2>
+    get_tensor(const unsigned int row,
+               const unsigned int position_within_column) const;
 
+    /**
+     * Return the transposed tensor-valued entry indexed by @p row and
+     * @p position_within_column. Only non-vectorized access is supported.
+     */
+    template <typename Number2 = Number>
+    dealii::Tensor<1, n_components, Number2>
+    get_transposed_tensor(const unsigned int row,
+                          const unsigned int position_within_column) const;
 
-  template <int simd_length>
-  DEAL_II_ALWAYS_INLINE inline unsigned int
-  SparsityPatternSIMD<simd_length>::n_rows() const
-  {
-    return row_starts.size() - 1;
-  }
+    /**
+     * Return the number of stored entries (per component).
+     */
+    std::size_t n_stored_elements() const;
 
+  protected:
+    const SparsityPatternSIMD<simd_length> *sparsity;
 
-  template <int simd_length>
-  DEAL_II_ALWAYS_INLINE inline std::size_t
-  SparsityPatternSIMD<simd_length>::n_nonzero_elements() const
-  {
-    Assert(row_starts.size() > 0, dealii::ExcNotInitialized());
+    /**
+     * Row starts of the stored entries, indexed identically to
+     * SparsityPatternSIMD::row_starts.
+     */
+    dealii::AlignedVector<std::size_t> row_starts;
 
-    return row_starts.back();
-  }
+    /**
+     * For every SIMD row in the vectorized row index region the number
+     * of omitted positions, and an index into omitted_offsets.
+     */
+    dealii::AlignedVector<unsigned int> n_omitted;
+    dealii::AlignedVector<std::size_t> omitted_starts;
 
+    /**
+     * For every omitted entry the offset of the (first component of the)
+     * transposed entry in the data array.
+     */
+    dealii::AlignedVector<unsigned int> omitted_offsets;
 
-  template <typename Number, int n_components, int simd_length>
-  template <typename Number2>
-  DEAL_II_ALWAYS_INLINE inline auto
-  SparseMatrixSIMD<Number, n_components, simd_length>::get_entry(
-      const unsigned int row, const unsigned int position_within_column) const
-      -> EntryType<Number2>
-  {
-    const auto result = get_tensor<Number2>(row, position_within_column);
-    if constexpr (n_components == 1)
-      return result[0];
-    else
-      return result;
-  }
+    dealii::AlignedVector<Number> data;
+  };
 
 
+  /**
+   * A read-only variant of SparseMatrixSIMD for matrices with a small
+   * number of distinct rows. This is the case for the \f$(c_{ij})\f$,
+   * mass and incidence matrices on affine (for example Cartesian) meshes
+   * built from a few reference shapes: Every row of the matrix is then
+   * determined by the shape of the patch of cells around the
+   * corresponding degree of freedom.
+   *
+   * Instead of storing all entries we store a table of all distinct
+   * rows (the "stencils") and for every row an offset into this table.
+   * Vectorized access gathers the entries of simd_length rows from the
+   * stencil table, which is usually small enough to stay in cache.
+   *
+   * The matrix is initialized from a fully assembled SparseMatrixSIMD
+   * (including ghost rows) and cannot be modified afterwards. If the
+   * stencil table does not reduce the memory footprint (for example on
+   * a non-affine mesh), the assembled matrix is kept instead and all
+   * accessors forward to it.
+   */
   template <typename Number, int n_components, int simd_length>
-  template <typename Number2>
-  DEAL_II_ALWAYS_INLINE inline dealii::Tensor<1, n_components, Number2>
-  SparseMatrixSIMD<Number, n_components, simd_length>::get_tensor(
-      const unsigned int row, const unsigned int position_within_column) const
+  class StencilSparseMatrixSIMD
   {
-    Assert(sparsity != nullptr, dealii::ExcNotInitialized());
-    AssertIndexRange(row, sparsity->row_starts.size() - 1);
-    AssertIndexRange(position_within_column, sparsity->row_length(row));
+  public:
+    StencilSparseMatrixSIMD();
 
-    dealii::Tensor<1, n_components, Number2> result;
+    /**
+     * Initialize the matrix from an assembled SparseMatrixSIMD @p matrix.
+     * Two rows are considered equal if all of their entries are
+     * identical. Rows are binned by a hash over the bit pattern of their
+     * entries; the hashes are computed in parallel.
+     *
+     * The function takes ownership of @p matrix. It is released if the
+     * stencil table is smaller than the assembled matrix and kept
+     * otherwise, see compressed().
+     */
+    void reinit(SparseMatrixSIMD<Number, n_components, simd_length> &&matrix);
 
-    if constexpr (std::is_same<Number, Number2>::value) {
+    using VectorizedArray = dealii::VectorizedArray<Number, simd_length>;
+
+    template <typename Number2>
+    using EntryType = typename ryujin::EntryType<Number2, n_components>::type;
+
+    /**
+     * Return the entry indexed by @p row and @p position_within_column.
+     * See SparseMatrixSIMD::get_entry().
+     */
+    template <typename Number2 = Number>
+    EntryType<Number2>
+    get_entry(const unsigned int row,
+              const unsigned int position_within_column) const;
+
+    /**
+     * Return the tensor-valued entry indexed by @p row and
+     * @p position_within_column. See SparseMatrixSIMD::get_tensor().
+     */
+    template <typename Number2 = Number>
+    dealii::Tensor<1, n_components, Number2>
+    get_tensor(const unsigned int row,
+               const unsigned int position_within_column) const;
+
+    /**
+     * Return the transposed entry indexed by @p row and
+     * @p position_within_column. Only non-vectorized access is supported.
+     */
+    template <typename Number2 = Number>
+    EntryType<Number2>
+    get_transposed_entry(const unsigned int row,
+                         const unsigned int position_within_column) const;
+
+    /**
+     * Return the transposed tensor-valued entry indexed by @p row and
+     * @p position_within_column. Only non-vectorized access is supported.
+     */
+    template <typename Number2 = Number>
+    dealii::Tensor<1, n_components, Number2>
+    get_transposed_tensor(const unsigned int row,
+                          const unsigned int position_within_column) const;
+
+    /**
+     * Return the number of distinct stencils (zero if the matrix is not
+     * compressed()).
+     */
+    unsigned int n_stencils() const;
+
+    /**
+     * Return whether the matrix is stored as a stencil table. If false,
+     * the stencil table did not reduce the memory footprint and the
+     * assembled matrix is used instead.
+     */
+    bool compressed() const;
+
+  protected:
+    const SparsityPatternSIMD<simd_length> *sparsity;
+
+    /**
+     * For every row the offset of the corresponding stencil in the
+     * stencils array.
+     */
+    dealii::AlignedVector<unsigned int> row_offsets;
+
+    /**
+     * All distinct stencils stored consecutively in row-major order,
+     * i.e., the entry at position p and component d of a row is found at
+     * row_offsets[row] + p * n_components + d.
+     */
+    dealii::AlignedVector<Number> stencils;
+
+    unsigned int n_stencils_;
+
+    bool compressed_;
+
+    /**
+     * The assembled matrix in case the stencil table does not reduce the
+     * memory footprint.
+     */
+    SparseMatrixSIMD<Number, n_components, simd_length> full_matrix;
+  };
+
+  /*
+   * Inline function  definitions:
+   */
+
+
+  inline void PersistentMPIRequests::clear()
+  {
+#ifdef DEAL_II_WITH_MPI
+    int finalized = 0;
+    MPI_Finalized(&finalized);
+
+    if (!finalized)
+      for (auto &it : requests_)
+        for (auto &request : it.second)
+          if (request != MPI_REQUEST_NULL)
+            MPI_Request_free(&request);
+#endif
+
+    requests_.clear();
+  }
+
+
+  template <int simd_length>
+  DEAL_II_ALWAYS_INLINE inline unsigned int
+  SparsityPatternSIMD<simd_length>::stride_of_row(const unsigned int row) const
+  {
+    AssertIndexRange(row, row_starts.size());
+
+    if (row < n_internal_dofs)
+      return simd_length;
+    else
+      return 1;
+  }
+
+
+  template <int simd_length>
+  DEAL_II_ALWAYS_INLINE inline const unsigned int *
+  SparsityPatternSIMD<simd_length>::columns(const unsigned int row) const
+  {
+    AssertIndexRange(row, row_starts.size() - 1);
+
+#ifdef COMPRESSED_COLUMN_INDICES
+    const bool vectorized = row < n_internal_dofs;
+    const unsigned int key = vectorized ? row / simd_length : row;
+    const unsigned int offset = vectorized ? row % simd_length : 0;
+
+    const auto escape = column_escapes[key];
+    if (escape != dealii::numbers::invalid_unsigned_int)
+      return uncompressed_columns.data() + escape + offset;
+
+    /* Decode the (SIMD) row into a thread-local buffer: */
+
+    static thread_local std::vector<unsigned int> buffer;
+
+    const std::size_t begin = row_starts[key];
+    const std::size_t size = row_starts[key + 1] - begin;
+    if (buffer.size() < size)
+      buffer.resize(size);
+
+    const std::int16_t *offsets = column_offsets.data() + begin;
+    const unsigned int base = row - offset;
+
+    if (vectorized) {
+      for (std::size_t c = 0; c < size; c += simd_length)
+        for (unsigned int k = 0; k < simd_length; ++k)
+          buffer[c + k] = base + k + offsets[c + k];
+    } else {
+      for (std::size_t c = 0; c < size; ++c)
+        buffer[c] = base + offsets[c];
+    }
+
+    return buffer.data() + offset;
+#else
+    if (row < n_internal_dofs)
+      return column_indices.data() + row_starts[row / simd_length] +
+             row % simd_length;
+    else
+      return column_indices.data() + row_starts[row];
+#endif
+  }
+
+
+  template <int simd_length>
+  DEAL_II_ALWAYS_INLINE inline unsigned int
+  SparsityPatternSIMD<simd_length>::column(
+      const unsigned int row, const unsigned int position_within_column) const
+  {
+    AssertIndexRange(row, row_starts.size() - 1);
+    AssertIndexRange(position_within_column, row_length(row));
+
+    const bool vectorized = row < n_internal_dofs;
+    const unsigned int key = vectorized ? row / simd_length : row;
+    const std::size_t index_within_row =
+        vectorized ? row % simd_length + position_within_column * simd_length
+                   : position_within_column;
+
+#ifdef COMPRESSED_COLUMN_INDICES
+    const auto escape = column_escapes[key];
+    if (escape != dealii::numbers::invalid_unsigned_int)
+      return uncompressed_columns[escape + index_within_row];
+
+    return row + column_offsets[row_starts[key] + index_within_row];
+#else
+    return column_indices[row_starts[key] + index_within_row];
+#endif
+  }
+
+
+  template <int simd_length>
+  DEAL_II_ALWAYS_INLINE inline unsigned int
+  SparsityPatternSIMD<simd_length>::row_length(const unsigned int row) const
+  {
+    AssertIndexRange(row, row_starts.size() - 1);
+
+    if (row < n_internal_dofs) {
+      const unsigned int simd_row = row / simd_length;
+      return (row_starts[simd_row + 1] - row_starts[simd_row]) / simd_length;
+    } else {
+      return row_starts[row + 1] - row_starts[row];
+    }
+  }
+
+
+  template <int simd_length>
+  DEAL_II_ALWAYS_INLINE inline unsigned int
+  SparsityPatternSIMD<simd_length>::n_rows() const
+  {
+    return row_starts.size() - 1;
+  }
+
+
+  template <int simd_length>
+  DEAL_II_ALWAYS_INLINE inline std::size_t
+  SparsityPatternSIMD<simd_length>::n_nonzero_elements() const
+  {
+    Assert(row_starts.size() > 0, dealii::ExcNotInitialized());
+
+    return row_starts.back();
+  }
+
+
+  template <int simd_length>
+  DEAL_II_ALWAYS_INLINE inline const unsigned int *
+  EdgeListSIMD<simd_length>::positions(const unsigned int row) const
+  {
+    AssertIndexRange(row, row_starts.size() - 1);
+
+    if (row < n_internal_dofs)
+      return batch_positions.data() + row_starts[row / simd_length];
+    else
+      return batch_positions.data() + row_starts[row];
+  }
+
+
+  template <int simd_length>
+  DEAL_II_ALWAYS_INLINE inline const unsigned int *
+  EdgeListSIMD<simd_length>::lane_masks(const unsigned int row) const
+  {
+    AssertIndexRange(row, row_starts.size() - 1);
+
+    if (row < n_internal_dofs)
+      return batch_lane_masks.data() + row_starts[row / simd_length];
+    else
+      return batch_lane_masks.data() + row_starts[row];
+  }
+
+
+  template <int simd_length>
+  DEAL_II_ALWAYS_INLINE inline unsigned int
+  EdgeListSIMD<simd_length>::n_batches(const unsigned int row) const
+  {
+    AssertIndexRange(row, row_starts.size() - 1);
+
+    if (row < n_internal_dofs) {
+      const unsigned int simd_row = row / simd_length;
+      return row_starts[simd_row + 1] - row_starts[simd_row];
+    } else {
+      return row_starts[row + 1] - row_starts[row];
+    }
+  }
+
+
+  template <int simd_length>
+  DEAL_II_ALWAYS_INLINE inline std::size_t
+  EdgeListSIMD<simd_length>::n_edges() const
+  {
+    return n_edges_;
+  }
+
+
+  template <typename Number, int n_components, int simd_length>
+  template <typename Number2>
+  DEAL_II_ALWAYS_INLINE inline auto
+  SparseMatrixSIMD<Number, n_components, simd_length>::get_entry(
+      const unsigned int row, const unsigned int position_within_column) const
+      -> EntryType<Number2>
+  {
+    const auto result = get_tensor<Number2>(row, position_within_column);
+    if constexpr (n_components == 1)
+      return result[0];
+    else
+      return result;
+  }
+
+
+  template <typename Number, int n_components, int simd_length>
+  template <typename Number2>
+  DEAL_II_ALWAYS_INLINE inline dealii::Tensor<1, n_components, Number2>
+  SparseMatrixSIMD<Number, n_components, simd_length>::get_tensor(
+      const unsigned int row, const unsigned int position_within_column) const
+  {
+    Assert(sparsity != nullptr, dealii::ExcNotInitialized());
+    AssertIndexRange(row, sparsity->row_starts.size() - 1);
+    AssertIndexRange(position_within_column, sparsity->row_length(row));
+
+    dealii::Tensor<1, n_components, Number2> result;
+
+    if constexpr (std::is_same_v<typename get_value_type<Number2>::type,
+                                 Number2>) {
       /*
        * Non-vectorized slow access. Supports all row indices in
        * [0,n_owned)
@@ -418,7 +1061,7 @@ namespace ryujin
                    d];
       }
 
-    } else if constexpr (std::is_same<VectorizedArray, Number2>::value) {
+    } else if constexpr (is_vectorized_array_of_width<Number2, simd_length>) {
       /*
        * Vectorized fast access. Indices must be in the range
        * [0,n_internal), index must be divisible by simd_length
@@ -436,8 +1079,15 @@ namespace ryujin
                          position_within_column * simd_length) *
                             n_components;
 
-      for (unsigned int d = 0; d < n_components; ++d)
-        result[d].load(load_pos + d * simd_length);
+      if constexpr (std::is_same<VectorizedArray, Number2>::value) {
+        for (unsigned int d = 0; d < n_components; ++d)
+          result[d].load(load_pos + d * simd_length);
+      } else {
+        /* Converting load (for example, float storage and double access): */
+        for (unsigned int d = 0; d < n_components; ++d)
+          for (unsigned int k = 0; k < simd_length; ++k)
+            result[d][k] = load_pos[d * simd_length + k];
+      }
 
     } else {
       /* not implemented */
@@ -476,7 +1126,53 @@ namespace ryujin
 
     dealii::Tensor<1, n_components, Number2> result;
 
-    if constexpr (std::is_same<Number, Number2>::value) {
+    if constexpr (n_components == 1) {
+      if (!transposed_data.empty()) {
+        /*
+         * Transpose-mirrored storage: access the shadow array exactly
+         * like get_tensor() accesses data.
+         */
+        if constexpr (std::is_same_v<typename get_value_type<Number2>::type,
+                                     Number2>) {
+          const std::size_t position =
+              row < sparsity->n_internal_dofs
+                  ? sparsity->row_starts[row / simd_length] +
+                        position_within_column * simd_length +
+                        row % simd_length
+                  : sparsity->row_starts[row] + position_within_column;
+          result[0] = transposed_data[position];
+
+        } else if constexpr (is_vectorized_array_of_width<Number2,
+                                                          simd_length>) {
+          Assert(row < sparsity->n_internal_dofs,
+                 dealii::ExcMessage(
+                     "Vectorized access only possible in vectorized part"));
+          Assert(row % simd_length == 0,
+                 dealii::ExcMessage(
+                     "Access only supported for rows at the SIMD granularity"));
+
+          const Number *load_pos =
+              transposed_data.data() + sparsity->row_starts[row / simd_length] +
+              position_within_column * simd_length;
+          if constexpr (std::is_same<VectorizedArray, Number2>::value) {
+            result[0].load(load_pos);
+          } else {
+            /* Converting load (for example, float storage, double access): */
+            for (unsigned int k = 0; k < simd_length; ++k)
+              result[0][k] = load_pos[k];
+          }
+
+        } else {
+          /* not implemented */
+          __builtin_trap();
+        }
+
+        return result;
+      }
+    }
+
+    if constexpr (std::is_same_v<typename get_value_type<Number2>::type,
+                                 Number2>) {
       /*
        * Non-vectorized slow access. Supports all row indices in
        * [0,n_owned)
@@ -492,9 +1188,7 @@ namespace ryujin
                                          position_within_column * simd_length];
         if (n_components > 1) {
           const unsigned int col =
-              sparsity->column_indices[sparsity->row_starts[simd_row] +
-                                       simd_offset +
-                                       position_within_column * simd_length];
+              sparsity->column(row, position_within_column);
           if (col < sparsity->n_internal_dofs)
             for (unsigned int d = 0; d < n_components; ++d)
               result[d] =
@@ -512,8 +1206,7 @@ namespace ryujin
                                          position_within_column];
         if (n_components > 1) {
           const unsigned int col =
-              sparsity->column_indices[sparsity->row_starts[row] +
-                                       position_within_column];
+              sparsity->column(row, position_within_column);
           if (col < sparsity->n_internal_dofs)
             for (unsigned int d = 0; d < n_components; ++d)
               result[d] =
@@ -526,7 +1219,7 @@ namespace ryujin
           result[0] = data[index];
       }
 
-    } else if constexpr (std::is_same<VectorizedArray, Number2>::value &&
+    } else if constexpr (is_vectorized_array_of_width<Number2, simd_length> &&
                          (n_components == 1)) {
       /*
        * Vectorized fast access. Indices must be in the range
@@ -542,8 +1235,14 @@ namespace ryujin
 
       const unsigned int offset = sparsity->row_starts[row / simd_length] +
                                   position_within_column * simd_length;
-      result[0].gather(data.data(),
-                       sparsity->indices_transposed.data() + offset);
+      if constexpr (std::is_same<VectorizedArray, Number2>::value) {
+        result[0].gather(data.data(),
+                         sparsity->indices_transposed.data() + offset);
+      } else {
+        /* Converting gather (for example, float storage, double access): */
+        for (unsigned int k = 0; k < simd_length; ++k)
+          result[0][k] = data[sparsity->indices_transposed[offset + k]];
+      }
 
     } else {
       /* not implemented */
@@ -592,7 +1291,8 @@ namespace ryujin
     AssertIndexRange(row, sparsity->row_starts.size() - 1);
     AssertIndexRange(position_within_column, sparsity->row_length(row));
 
-    if constexpr (std::is_same<Number, Number2>::value) {
+    if constexpr (std::is_same_v<typename get_value_type<Number2>::type,
+                                 Number2>) {
       /*
        * Non-vectorized slow access. Supports all row indices in
        * [0,n_owned)
@@ -606,16 +1306,30 @@ namespace ryujin
           data[(sparsity->row_starts[simd_row] +
                 position_within_column * simd_length) *
                    n_components +
-               d * simd_length + simd_offset] = entry[d];
+               d * simd_length + simd_offset] = Number(entry[d]);
       } else {
         // go through standard part
         for (unsigned int d = 0; d < n_components; ++d)
           data[(sparsity->row_starts[row] + position_within_column) *
                    n_components +
-               d] = entry[d];
+               d] = Number(entry[d]);
+      }
+
+      if constexpr (n_components == 1) {
+        if (!transposed_data.empty()) {
+          /* Scatter into the transpose-mirrored shadow array: */
+          const std::size_t position =
+              row < sparsity->n_internal_dofs
+                  ? sparsity->row_starts[row / simd_length] +
+                        position_within_column * simd_length +
+                        row % simd_length
+                  : sparsity->row_starts[row] + position_within_column;
+          transposed_data[sparsity->indices_transposed[position]] =
+              Number(entry[0]);
+        }
       }
 
-    } else if constexpr (std::is_same<VectorizedArray, Number2>::value) {
+    } else if constexpr (is_vectorized_array_of_width<Number2, simd_length>) {
       /*
        * Vectorized fast access. Indices must be in the range
        * [0,n_internal), index must be divisible by simd_length
@@ -632,12 +1346,36 @@ namespace ryujin
           data.data() + (sparsity->row_starts[row / simd_length] +
                          position_within_column * simd_length) *
                             n_components;
-      if (do_streaming_store)
-        for (unsigned int d = 0; d < n_components; ++d)
-          entry[d].streaming_store(store_pos + d * simd_length);
-      else
+      if constexpr (std::is_same<VectorizedArray, Number2>::value) {
+        if (do_streaming_store)
+          for (unsigned int d = 0; d < n_components; ++d)
+            entry[d].streaming_store(store_pos + d * simd_length);
+        else
+          for (unsigned int d = 0; d < n_components; ++d)
+            entry[d].store(store_pos + d * simd_length);
+      } else {
+        /* Converting store (for example, double access, float storage): */
         for (unsigned int d = 0; d < n_components; ++d)
-          entry[d].store(store_pos + d * simd_length);
+          for (unsigned int k = 0; k < simd_length; ++k)
+            store_pos[d * simd_length + k] = Number(entry[d][k]);
+      }
+
+      if constexpr (n_components == 1) {
+        if (!transposed_data.empty()) {
+          /* Scatter into the transpose-mirrored shadow array: */
+          const unsigned int *offsets =
+              sparsity->indices_transposed.data() +
+              sparsity->row_starts[row / simd_length] +
+              position_within_column * simd_length;
+          if constexpr (std::is_same<VectorizedArray, Number2>::value) {
+            entry[0].scatter(offsets, transposed_data.data());
+          } else {
+            /* Converting scatter (double access, float storage): */
+            for (unsigned int k = 0; k < simd_length; ++k)
+              transposed_data[offsets[k]] = Number(entry[0][k]);
+          }
+        }
+      }
 
     } else {
       /* not implemented */
@@ -647,51 +1385,238 @@ namespace ryujin
 
 
   template <typename Number, int n_components, int simd_length>
-  inline void
-  SparseMatrixSIMD<Number, n_components, simd_length>::update_ghost_rows_start(
-      const unsigned int communication_channel)
+  template <typename Number2>
+  DEAL_II_ALWAYS_INLINE inline void
+  SparseMatrixSIMD<Number, n_components, simd_length>::write_transposed_entry(
+      const Number2 entry,
+      const unsigned int row,
+      const unsigned int position_within_column)
   {
-#ifdef DEAL_II_WITH_MPI
-    AssertIndexRange(communication_channel, 200);
-
-    const unsigned int mpi_tag =
-        dealii::Utilities::MPI::internal::Tags::partitioner_export_start +
-        communication_channel;
-    Assert(mpi_tag <=
-               dealii::Utilities::MPI::internal::Tags::partitioner_export_end,
-           dealii::ExcInternalError());
-
-    const std::size_t n_indices = sparsity->entries_to_be_sent.size();
-    exchange_buffer.resize_fast(n_components * n_indices);
+    static_assert(
+        n_components == 1,
+        "Attempted to write a scalar value into a tensor-valued matrix entry");
 
-    requests.resize(sparsity->receive_targets.size() +
-                    sparsity->send_targets.size());
+    Assert(sparsity != nullptr, dealii::ExcNotInitialized());
+    AssertIndexRange(row, sparsity->row_starts.size() - 1);
+    AssertIndexRange(position_within_column, sparsity->row_length(row));
 
+    if constexpr (std::is_same_v<typename get_value_type<Number2>::type,
+                                 Number2>) {
+      /*
+       * Non-vectorized slow access. Supports all row indices in
+       * [0,n_owned)
+       */
+
+      if (row < sparsity->n_internal_dofs) {
+        // go through vectorized part
+        const unsigned int simd_row = row / simd_length;
+        const unsigned int simd_offset = row % simd_length;
+        const std::size_t index =
+            sparsity->indices_transposed[sparsity->row_starts[simd_row] +
+                                         simd_offset +
+                                         position_within_column * simd_length];
+        data[index] = Number(entry);
+      } else {
+        // go through standard part
+        const std::size_t index =
+            sparsity->indices_transposed[sparsity->row_starts[row] +
+                                         position_within_column];
+        data[index] = Number(entry);
+      }
+
+    } else if constexpr (is_vectorized_array_of_width<Number2, simd_length>) {
+      /*
+       * Vectorized fast access. Indices must be in the range
+       * [0,n_internal), index must be divisible by simd_length
+       */
+
+      Assert(row < sparsity->n_internal_dofs,
+             dealii::ExcMessage(
+                 "Vectorized access only possible in vectorized part"));
+      Assert(row % simd_length == 0,
+             dealii::ExcMessage(
+                 "Access only supported for rows at the SIMD granularity"));
+
+      const unsigned int offset = sparsity->row_starts[row / simd_length] +
+                                  position_within_column * simd_length;
+      if constexpr (std::is_same<VectorizedArray, Number2>::value) {
+        entry.scatter(sparsity->indices_transposed.data() + offset,
+                      data.data());
+      } else {
+        /* Converting scatter (for example, double access, float storage): */
+        for (unsigned int k = 0; k < simd_length; ++k)
+          data[sparsity->indices_transposed[offset + k]] = Number(entry[k]);
+      }
+
+    } else {
+      /* not implemented */
+      __builtin_trap();
+    }
+  }
+
+
+  template <typename Number, int n_components, int simd_length>
+  inline void
+  SparseMatrixSIMD<Number, n_components, simd_length>::update_ghost_rows_start(
+      const unsigned int communication_channel)
+  {
+#ifdef DEAL_II_WITH_MPI
+    AssertIndexRange(communication_channel, 200);
+
+    const unsigned int mpi_tag =
+        dealii::Utilities::MPI::internal::Tags::partitioner_export_start +
+        communication_channel;
+    Assert(mpi_tag <=
+               dealii::Utilities::MPI::internal::Tags::partitioner_export_end,
+           dealii::ExcInternalError());
+
+    const std::size_t n_indices = sparsity->entries_to_be_sent.size();
+    const auto &receive_targets = sparsity->receive_targets;
+    const auto &send_targets = sparsity->send_targets;
+    const auto n_receives = receive_targets.size();
+    const auto n_sends = send_targets.size();
+
+#ifdef SHARED_MEMORY_EXCHANGE
     /*
-     * Set up MPI receive requests. We will always receive data for indices
-     * in the range [n_locally_owned_, n_locally_relevant_), thus the DATA
-     * is stored in non-vectorized CSR format.
+     * We store the exchange buffer in a node-local shared memory window.
+     * MPI ranks on the same node read their ghost rows directly from the
+     * window and we only send zero-byte notification messages (and
+     * receive zero-byte acknowledgments once the data has been read).
      */
+    AssertThrow(shared_window.valid(),
+                dealii::ExcMessage("No shared memory window has been set up "
+                                   "for this matrix (did you call reinit()?)"));
+    const auto &node_communicator = sparsity->node_communicator;
+    auto send_buffer = reinterpret_cast<Number *>(shared_window.local_memory());
+    const auto n_requests = 2 * (n_receives + n_sends);
+#else
+    const auto n_requests = n_receives + n_sends;
+#endif
 
-    {
-      const auto &targets = sparsity->receive_targets;
-      for (unsigned int p = 0; p < targets.size(); ++p) {
-        const int ierr = MPI_Irecv(
+    /*
+     * Set up persistent MPI requests on first use of a communication
+     * channel. The send and receive targets (and thus message sizes and
+     * buffer locations) do not change until the next call to reinit().
+     */
+
+    auto &channel_requests = requests[communication_channel];
+    if (channel_requests.size() != n_requests) {
+      channel_requests.resize(n_requests, MPI_REQUEST_NULL);
+#ifndef SHARED_MEMORY_EXCHANGE
+      exchange_buffer.resize_fast(n_components * n_indices);
+      auto send_buffer = exchange_buffer.data();
+#endif
+
+      /*
+       * We will always receive data for indices in the range
+       * [n_locally_owned_, n_locally_relevant_), thus the DATA is stored
+       * in non-vectorized CSR format.
+       */
+      for (unsigned int p = 0; p < n_receives; ++p) {
+#ifdef SHARED_MEMORY_EXCHANGE
+        const auto rank =
+            node_communicator.shared_rank(receive_targets[p].first);
+        if (rank >= 0) {
+          int ierr = MPI_Recv_init(nullptr,
+                                   0,
+                                   MPI_BYTE,
+                                   receive_targets[p].first,
+                                   mpi_tag,
+                                   sparsity->mpi_communicator,
+                                   &channel_requests[p]);
+          AssertThrowMPI(ierr);
+          ierr = MPI_Send_init(nullptr,
+                               0,
+                               MPI_BYTE,
+                               rank,
+                               mpi_tag,
+                               node_communicator.communicator(),
+                               &channel_requests[n_receives + n_sends + p]);
+          AssertThrowMPI(ierr);
+          continue;
+        }
+#endif
+        const int ierr = MPI_Recv_init(
             data.data() +
                 n_components *
                     (sparsity->row_starts[sparsity->n_locally_owned_dofs] +
-                     (p == 0 ? 0 : targets[p - 1].second)),
-            (targets[p].second - (p == 0 ? 0 : targets[p - 1].second)) *
+                     (p == 0 ? 0 : receive_targets[p - 1].second)),
+            (receive_targets[p].second -
+             (p == 0 ? 0 : receive_targets[p - 1].second)) *
+                n_components * sizeof(Number),
+            MPI_BYTE,
+            receive_targets[p].first,
+            mpi_tag,
+            sparsity->mpi_communicator,
+            &channel_requests[p]);
+        AssertThrowMPI(ierr);
+      }
+
+      /*
+       * We send from the exchange buffer that is populated compatible with
+       * the CSR storage format of the receiving MPI rank.
+       */
+      for (unsigned int p = 0; p < n_sends; ++p) {
+#ifdef SHARED_MEMORY_EXCHANGE
+        const auto rank = node_communicator.shared_rank(send_targets[p].first);
+        if (rank >= 0) {
+          int ierr = MPI_Send_init(nullptr,
+                                   0,
+                                   MPI_BYTE,
+                                   send_targets[p].first,
+                                   mpi_tag,
+                                   sparsity->mpi_communicator,
+                                   &channel_requests[n_receives + p]);
+          AssertThrowMPI(ierr);
+          ierr = MPI_Recv_init(
+              nullptr,
+              0,
+              MPI_BYTE,
+              rank,
+              mpi_tag,
+              node_communicator.communicator(),
+              &channel_requests[2 * n_receives + n_sends + p]);
+          AssertThrowMPI(ierr);
+          continue;
+        }
+#endif
+        const int ierr = MPI_Send_init(
+            send_buffer +
+                n_components * (p == 0 ? 0 : send_targets[p - 1].second),
+            (send_targets[p].second -
+             (p == 0 ? 0 : send_targets[p - 1].second)) *
                 n_components * sizeof(Number),
             MPI_BYTE,
-            targets[p].first,
+            send_targets[p].first,
             mpi_tag,
             sparsity->mpi_communicator,
-            &requests[p]);
+            &channel_requests[n_receives + p]);
         AssertThrowMPI(ierr);
       }
     }
 
+    active_channel = communication_channel;
+
+    /* Post receives: */
+
+    if (n_receives > 0) {
+      const int ierr = MPI_Startall(n_receives, channel_requests.data());
+      AssertThrowMPI(ierr);
+    }
+
+#ifdef SHARED_MEMORY_EXCHANGE
+    /* Post receives for acknowledgments: */
+    for (unsigned int p = 0; p < n_sends; ++p) {
+      auto &request = channel_requests[2 * n_receives + n_sends + p];
+      if (request != MPI_REQUEST_NULL) {
+        const int ierr = MPI_Start(&request);
+        AssertThrowMPI(ierr);
+      }
+    }
+#else
+    auto send_buffer = exchange_buffer.data();
+#endif
+
     /*
      * Copy all entries that we plan to send over to the exchange buffer.
      * Here, we have to be careful with indices falling into the "locally
@@ -710,7 +1635,7 @@ namespace ryujin
         const unsigned int simd_row = row / simd_length;
         const unsigned int simd_offset = row % simd_length;
         for (unsigned int d = 0; d < n_components; ++d)
-          exchange_buffer[n_components * c + d] =
+          send_buffer[n_components * c + d] =
               data[(sparsity->row_starts[simd_row] +
                     position_within_column * simd_length) *
                        n_components +
@@ -718,34 +1643,24 @@ namespace ryujin
       } else {
         // go through standard part
         for (unsigned int d = 0; d < n_components; ++d)
-          exchange_buffer[n_components * c + d] =
+          send_buffer[n_components * c + d] =
               data[(sparsity->row_starts[row] + position_within_column) *
                        n_components +
                    d];
       }
     }
 
-    /*
-     * Set up MPI send requests. We have copied everything we intend to
-     * send to the exchange_buffer compatible with the CSR storage format
-     * of the receiving MPI rank.
-     */
+#ifdef SHARED_MEMORY_EXCHANGE
+    /* Make the exchange buffer visible to other MPI ranks on the node: */
+    shared_window.sync();
+#endif
 
-    {
-      const auto &targets = sparsity->send_targets;
-      for (unsigned int p = 0; p < targets.size(); ++p) {
-        const int ierr = MPI_Isend(
-            exchange_buffer.data() +
-                n_components * (p == 0 ? 0 : targets[p - 1].second),
-            (targets[p].second - (p == 0 ? 0 : targets[p - 1].second)) *
-                n_components * sizeof(Number),
-            MPI_BYTE,
-            targets[p].first,
-            mpi_tag,
-            sparsity->mpi_communicator,
-            &requests[p + sparsity->receive_targets.size()]);
-        AssertThrowMPI(ierr);
-      }
+    /* Post sends: */
+
+    if (n_sends > 0) {
+      const int ierr =
+          MPI_Startall(n_sends, channel_requests.data() + n_receives);
+      AssertThrowMPI(ierr);
     }
 #endif
   }
@@ -756,10 +1671,71 @@ namespace ryujin
       update_ghost_rows_finish()
   {
 #ifdef DEAL_II_WITH_MPI
-    const int ierr =
-        MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+    auto &channel_requests = requests[active_channel];
+
+#ifdef SHARED_MEMORY_EXCHANGE
+    /*
+     * Wait for all incoming messages and notifications, read ghost rows
+     * from the exchange buffer of MPI ranks on the same node and
+     * acknowledge that we are done reading:
+     */
+
+    const auto &receive_targets = sparsity->receive_targets;
+    const auto n_receives = receive_targets.size();
+    const auto n_sends = sparsity->send_targets.size();
+
+    int ierr = MPI_Waitall(
+        n_receives, channel_requests.data(), MPI_STATUSES_IGNORE);
+    AssertThrowMPI(ierr);
+
+    shared_window.sync();
+
+    for (unsigned int p = 0; p < n_receives; ++p) {
+      const auto rank =
+          sparsity->node_communicator.shared_rank(receive_targets[p].first);
+      if (rank < 0)
+        continue;
+
+      const auto begin = (p == 0 ? 0 : receive_targets[p - 1].second);
+      const auto source =
+          reinterpret_cast<const Number *>(shared_window.memory(rank)) +
+          n_components * sparsity->receive_offsets[p];
+      std::copy(source,
+                source + n_components * (receive_targets[p].second - begin),
+                data.data() +
+                    n_components *
+                        (sparsity->row_starts[sparsity->n_locally_owned_dofs] +
+                         begin));
+
+      ierr = MPI_Start(&channel_requests[n_receives + n_sends + p]);
+      AssertThrowMPI(ierr);
+    }
+
+    ierr = MPI_Waitall(channel_requests.size() - n_receives,
+                       channel_requests.data() + n_receives,
+                       MPI_STATUSES_IGNORE);
+    AssertThrowMPI(ierr);
+#else
+    const int ierr = MPI_Waitall(
+        channel_requests.size(), channel_requests.data(), MPI_STATUSES_IGNORE);
     AssertThrowMPI(ierr);
 #endif
+#endif
+
+    if constexpr (n_components == 1) {
+      if (!transposed_data.empty()) {
+        /*
+         * Update the transpose-mirrored shadow array with the received
+         * ghost rows. The transposed positions of ghost row entries are
+         * all located in locally owned rows and are never written to by
+         * write_entry().
+         */
+        const auto &row_starts = sparsity->row_starts;
+        const auto n_owned = sparsity->n_locally_owned_dofs;
+        for (std::size_t c = row_starts[n_owned]; c < row_starts.back(); ++c)
+          transposed_data[sparsity->indices_transposed[c]] = data[c];
+      }
+    }
   }
 
 
@@ -771,4 +1747,335 @@ namespace ryujin
     update_ghost_rows_finish();
   }
 
+
+  template <typename Number, int n_components, int simd_length>
+  template <typename Number2>
+  DEAL_II_ALWAYS_INLINE inline dealii::Tensor<1, n_components, Number2>
+  AntisymmetricSparseMatrixSIMD<Number, n_components, simd_length>::get_tensor(
+      const unsigned int row, const unsigned int position_within_column) const
+  {
+    Assert(sparsity != nullptr, dealii::ExcNotInitialized());
+    AssertIndexRange(row, row_starts.size() - 1);
+    AssertIndexRange(position_within_column, sparsity->row_length(row));
+
+    dealii::Tensor<1, n_components, Number2> result;
+
+    if constexpr (std::is_same_v<typename get_value_type<Number2>::type,
+                                 Number2>) {
+      /*
+       * Non-vectorized slow access. Supports all row indices in
+       * [0,n_owned)
+       */
+
+      if (row < sparsity->n_internal_dofs) {
+        // go through vectorized part
+        const unsigned int simd_row = row / simd_length;
+        const unsigned int simd_offset = row % simd_length;
+        const unsigned int n = n_omitted[simd_row];
+
+        if (position_within_column == 0 || position_within_column > n) {
+          const unsigned int position =
+              position_within_column == 0 ? 0 : position_within_column - n;
+          for (unsigned int d = 0; d < n_components; ++d)
+            result[d] =
+                data[(row_starts[simd_row] + position * simd_length) *
+                         n_components +
+                     d * simd_length + simd_offset];
+        } else {
+          // reconstruct omitted entry from the transposed entry
+          const unsigned int offset =
+              omitted_offsets[omitted_starts[simd_row] +
+                              (position_within_column - 1) * simd_length +
+                              simd_offset];
+          for (unsigned int d = 0; d < n_components; ++d)
+            result[d] = -data[offset + d * simd_length];
+        }
+
+      } else {
+        // go through standard part
+        for (unsigned int d = 0; d < n_components; ++d)
+          result[d] =
+              data[(row_starts[row] + position_within_column) * n_components +
+                   d];
+      }
+
+    } else if constexpr (is_vectorized_array_of_width<Number2, simd_length>) {
+      /*
+       * Vectorized fast access. Indices must be in the range
+       * [0,n_internal), index must be divisible by simd_length
+       */
+
+      Assert(row < sparsity->n_internal_dofs,
+             dealii::ExcMessage(
+                 "Vectorized access only possible in vectorized part"));
+      Assert(row % simd_length == 0,
+             dealii::ExcMessage(
+                 "Access only supported for rows at the SIMD granularity"));
+
+      const unsigned int simd_row = row / simd_length;
+      const unsigned int n = n_omitted[simd_row];
+
+      if (position_within_column == 0 || position_within_column > n) {
+        const unsigned int position =
+            position_within_column == 0 ? 0 : position_within_column - n;
+        const Number *load_pos =
+            data.data() +
+            (row_starts[simd_row] + position * simd_length) * n_components;
+
+        if constexpr (std::is_same<VectorizedArray, Number2>::value) {
+          for (unsigned int d = 0; d < n_components; ++d)
+            result[d].load(load_pos + d * simd_length);
+        } else {
+          /* Converting load (for example, float storage, double access): */
+          for (unsigned int d = 0; d < n_components; ++d)
+            for (unsigned int k = 0; k < simd_length; ++k)
+              result[d][k] = load_pos[d * simd_length + k];
+        }
+
+      } else {
+        /* Reconstruct omitted entries from the transposed entries: */
+        const unsigned int *offsets =
+            omitted_offsets.data() + omitted_starts[simd_row] +
+            (position_within_column - 1) * simd_length;
+
+        if constexpr (std::is_same<VectorizedArray, Number2>::value) {
+          for (unsigned int d = 0; d < n_components; ++d) {
+            result[d].gather(data.data() + d * simd_length, offsets);
+            result[d] = -result[d];
+          }
+        } else {
+          /* Converting gather (for example, float storage, double access): */
+          for (unsigned int d = 0; d < n_components; ++d)
+            for (unsigned int k = 0; k < simd_length; ++k)
+              result[d][k] = -data[offsets[k] + d * simd_length];
+        }
+      }
+
+    } else {
+      /* not implemented */
+      __builtin_trap();
+    }
+
+    return result;
+  }
+
+
+  template <typename Number, int n_components, int simd_length>
+  template <typename Number2>
+  DEAL_II_ALWAYS_INLINE inline dealii::Tensor<1, n_components, Number2>
+  AntisymmetricSparseMatrixSIMD<Number, n_components, simd_length>::
+      get_transposed_tensor(const unsigned int row,
+                            const unsigned int position_within_column) const
+  {
+    static_assert(std::is_same_v<typename get_value_type<Number2>::type,
+                                 Number2>,
+                  "Only non-vectorized access is supported");
+
+    Assert(sparsity != nullptr, dealii::ExcNotInitialized());
+    AssertIndexRange(row, row_starts.size() - 1);
+    AssertIndexRange(position_within_column, sparsity->row_length(row));
+
+    const bool vectorized = row < sparsity->n_internal_dofs;
+
+    /* The transposed entry of an omitted entry is always stored: */
+    if (vectorized && position_within_column != 0 &&
+        position_within_column <= n_omitted[row / simd_length])
+      return -get_tensor<Number2>(row, position_within_column);
+
+    /*
+     * Otherwise, translate the transposed index into a row and position
+     * within the row of the transposed entry:
+     */
+
+    const std::size_t index =
+        sparsity->indices_transposed
+            [vectorized ? sparsity->row_starts[row / simd_length] +
+                              position_within_column * simd_length +
+                              row % simd_length
+                        : sparsity->row_starts[row] + position_within_column];
+
+    const unsigned int col = sparsity->column(row, position_within_column);
+
+    if (col < sparsity->n_internal_dofs) {
+      const unsigned int simd_offset = col % simd_length;
+      const unsigned int position =
+          (index - sparsity->row_starts[col / simd_length] - simd_offset) /
+          simd_length;
+      return get_tensor<Number2>(col, position);
+    } else {
+      return get_tensor<Number2>(col, index - sparsity->row_starts[col]);
+    }
+  }
+
+
+  template <typename Number, int n_components, int simd_length>
+  DEAL_II_ALWAYS_INLINE inline std::size_t
+  AntisymmetricSparseMatrixSIMD<Number, n_components, simd_length>::
+      n_stored_elements() const
+  {
+    return row_starts.back();
+  }
+
+
+  template <typename Number, int n_components, int simd_length>
+  template <typename Number2>
+  DEAL_II_ALWAYS_INLINE inline auto
+  StencilSparseMatrixSIMD<Number, n_components, simd_length>::get_entry(
+      const unsigned int row, const unsigned int position_within_column) const
+      -> EntryType<Number2>
+  {
+    const auto result = get_tensor<Number2>(row, position_within_column);
+    if constexpr (n_components == 1)
+      return result[0];
+    else
+      return result;
+  }
+
+
+  template <typename Number, int n_components, int simd_length>
+  template <typename Number2>
+  DEAL_II_ALWAYS_INLINE inline dealii::Tensor<1, n_components, Number2>
+  StencilSparseMatrixSIMD<Number, n_components, simd_length>::get_tensor(
+      const unsigned int row, const unsigned int position_within_column) const
+  {
+    Assert(sparsity != nullptr, dealii::ExcNotInitialized());
+
+    if (!compressed_)
+      return full_matrix.template get_tensor<Number2>(row,
+                                                      position_within_column);
+
+    AssertIndexRange(row, row_offsets.size());
+    AssertIndexRange(position_within_column, sparsity->row_length(row));
+
+    dealii::Tensor<1, n_components, Number2> result;
+
+    if constexpr (std::is_same_v<typename get_value_type<Number2>::type,
+                                 Number2>) {
+      /*
+       * Non-vectorized access. Supports all row indices in
+       * [0,n_relevant)
+       */
+      const Number *load_pos = stencils.data() + row_offsets[row] +
+                               position_within_column * n_components;
+      for (unsigned int d = 0; d < n_components; ++d)
+        result[d] = load_pos[d];
+
+    } else if constexpr (is_vectorized_array_of_width<Number2, simd_length>) {
+      /*
+       * Vectorized access. Indices must be in the range [0,n_internal),
+       * index must be divisible by simd_length
+       */
+
+      Assert(row < sparsity->n_internal_dofs,
+             dealii::ExcMessage(
+                 "Vectorized access only possible in vectorized part"));
+      Assert(row % simd_length == 0,
+             dealii::ExcMessage(
+                 "Access only supported for rows at the SIMD granularity"));
+
+      unsigned int offsets[simd_length];
+      for (unsigned int k = 0; k < simd_length; ++k)
+        offsets[k] =
+            row_offsets[row + k] + position_within_column * n_components;
+
+      if constexpr (std::is_same<VectorizedArray, Number2>::value) {
+        for (unsigned int d = 0; d < n_components; ++d)
+          result[d].gather(stencils.data() + d, offsets);
+      } else {
+        /* Converting gather (for example, float storage, double access): */
+        for (unsigned int d = 0; d < n_components; ++d)
+          for (unsigned int k = 0; k < simd_length; ++k)
+            result[d][k] = stencils[offsets[k] + d];
+      }
+
+    } else {
+      /* not implemented */
+      __builtin_trap();
+    }
+
+    return result;
+  }
+
+
+  template <typename Number, int n_components, int simd_length>
+  template <typename Number2>
+  DEAL_II_ALWAYS_INLINE inline auto
+  StencilSparseMatrixSIMD<Number, n_components, simd_length>::
+      get_transposed_entry(const unsigned int row,
+                           const unsigned int position_within_column) const
+      -> EntryType<Number2>
+  {
+    const auto result =
+        get_transposed_tensor<Number2>(row, position_within_column);
+    if constexpr (n_components == 1)
+      return result[0];
+    else
+      return result;
+  }
+
+
+  template <typename Number, int n_components, int simd_length>
+  template <typename Number2>
+  DEAL_II_ALWAYS_INLINE inline dealii::Tensor<1, n_components, Number2>
+  StencilSparseMatrixSIMD<Number, n_components, simd_length>::
+      get_transposed_tensor(const unsigned int row,
+                            const unsigned int position_within_column) const
+  {
+    static_assert(std::is_same_v<typename get_value_type<Number2>::type,
+                                 Number2>,
+                  "Only non-vectorized access is supported");
+
+    Assert(sparsity != nullptr, dealii::ExcNotInitialized());
+
+    if (!compressed_)
+      return full_matrix.template get_transposed_tensor<Number2>(
+          row, position_within_column);
+
+    AssertIndexRange(row, row_offsets.size());
+    AssertIndexRange(position_within_column, sparsity->row_length(row));
+
+    /*
+     * Translate the transposed index into a row and position within the
+     * row of the transposed entry:
+     */
+
+    const bool vectorized = row < sparsity->n_internal_dofs;
+    const std::size_t index =
+        sparsity->indices_transposed
+            [vectorized ? sparsity->row_starts[row / simd_length] +
+                              position_within_column * simd_length +
+                              row % simd_length
+                        : sparsity->row_starts[row] + position_within_column];
+
+    const unsigned int col = sparsity->column(row, position_within_column);
+
+    if (col < sparsity->n_internal_dofs) {
+      const unsigned int simd_offset = col % simd_length;
+      const unsigned int position =
+          (index - sparsity->row_starts[col / simd_length] - simd_offset) /
+          simd_length;
+      return get_tensor<Number2>(col, position);
+    } else {
+      return get_tensor<Number2>(col, index - sparsity->row_starts[col]);
+    }
+  }
+
+
+  template <typename Number, int n_components, int simd_length>
+  DEAL_II_ALWAYS_INLINE inline unsigned int
+  StencilSparseMatrixSIMD<Number, n_components, simd_length>::n_stencils()
+      const
+  {
+    return n_stencils_;
+  }
+
+
+  template <typename Number, int n_components, int simd_length>
+  DEAL_II_ALWAYS_INLINE inline bool
+  StencilSparseMatrixSIMD<Number, n_components, simd_length>::compressed()
+      const
+  {
+    return compressed_;
+  }
+
 } // namespace ryujin
@@ -10,12 +10,18 @@
 #include <deal.II/base/vectorization.h>
 #include <deal.II/lac/sparse_matrix.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <unordered_map>
+
 namespace ryujin
 {
 
   template <int simd_length>
   SparsityPatternSIMD<simd_length>::SparsityPatternSIMD()
       : n_internal_dofs(0)
+      , n_export_indices(0)
       , row_starts(1)
       , mpi_communicator(MPI_COMM_SELF)
   {
@@ -48,6 +54,13 @@ namespace ryujin
     this->n_locally_owned_dofs = partitioner->locally_owned_size();
     this->partitioner = partitioner;
 
+    n_export_indices = 0;
+    for (const auto &it : partitioner->import_indices())
+      if (it.second <= n_internal_dofs)
+        n_export_indices = std::max(n_export_indices, it.second);
+    n_export_indices =
+        (n_export_indices + simd_length - 1) / simd_length * simd_length;
+
     const auto n_locally_relevant_dofs =
         partitioner->locally_owned_size() + partitioner->n_ghost_indices();
 
@@ -82,6 +95,11 @@ namespace ryujin
     Assert(n_locally_owned_dofs <= sparsity.n_rows(),
            dealii::ExcInternalError());
 
+#ifdef COMPRESSED_COLUMN_INDICES
+    /* Temporary storage, compressed into column_offsets below: */
+    dealii::AlignedVector<unsigned int> column_indices;
+#endif
+
     row_starts.resize_fast(sparsity.n_rows() + 1);
     column_indices.resize_fast(sparsity.n_nonzero_elements());
     indices_transposed.resize_fast(sparsity.n_nonzero_elements());
@@ -91,9 +109,23 @@ namespace ryujin
                                    "billion matrix entries per MPI rank. Try to"
                                    " split into smaller problems with MPI"));
 
-    /* Vectorized part: */
+    /*
+     * Compute row starts upfront so that column indices and transposed
+     * indices can be first touched by the threads working on them:
+     */
 
     row_starts[0] = 0;
+    for (unsigned int i = 0; i < n_internal_dofs; i += simd_length)
+      row_starts[i / simd_length + 1] =
+          row_starts[i / simd_length] + simd_length * sparsity.row_length(i);
+    row_starts[n_internal_dofs] = row_starts[n_internal_dofs / simd_length];
+    for (unsigned int i = n_internal_dofs; i < sparsity.n_rows(); ++i)
+      row_starts[i + 1] = row_starts[i] + sparsity.row_length(i);
+
+    first_touch(column_indices);
+    first_touch(indices_transposed);
+
+    /* Vectorized part: */
 
     unsigned int *col_ptr = column_indices.data();
     unsigned int *transposed_ptr = indices_transposed.data();
@@ -147,6 +179,62 @@ namespace ryujin
 
     Assert(col_ptr == column_indices.end(), dealii::ExcInternalError());
 
+#ifdef COMPRESSED_COLUMN_INDICES
+    /*
+     * Compress column indices into 16 bit offsets relative to the row
+     * index. With a bandwidth reducing renumbering (such as Cuthill-McKee)
+     * this is possible for almost all rows. (SIMD) rows with an offset
+     * that does not fit into 16 bits are stored uncompressed:
+     */
+    {
+      first_touch(column_offsets);
+      column_escapes.resize_fast(sparsity.n_rows());
+      column_escapes.fill(dealii::numbers::invalid_unsigned_int);
+      std::vector<unsigned int> uncompressed;
+
+      const auto compress = [&](const unsigned int key,
+                                const unsigned int stride,
+                                const unsigned int row) {
+        const std::size_t begin = row_starts[key];
+        const std::size_t end = row_starts[key + 1];
+
+        const auto offset = [&](const std::size_t e) {
+          return static_cast<long int>(column_indices[e]) -
+                 static_cast<long int>(row + (e - begin) % stride);
+        };
+
+        bool fits = true;
+        for (std::size_t e = begin; e < end; ++e)
+          if (offset(e) < std::numeric_limits<std::int16_t>::min() ||
+              offset(e) > std::numeric_limits<std::int16_t>::max()) {
+            fits = false;
+            break;
+          }
+
+        if (fits) {
+          for (std::size_t e = begin; e < end; ++e)
+            column_offsets[e] = static_cast<std::int16_t>(offset(e));
+        } else {
+          column_escapes[key] = uncompressed.size();
+          for (std::size_t e = begin; e < end; ++e) {
+            column_offsets[e] = 0;
+            uncompressed.push_back(column_indices[e]);
+          }
+        }
+      };
+
+      for (unsigned int i = 0; i < n_internal_dofs; i += simd_length)
+        compress(i / simd_length, simd_length, i);
+      for (unsigned int i = n_internal_dofs; i < sparsity.n_rows(); ++i)
+        compress(i, 1, i);
+
+      uncompressed_columns.resize_fast(uncompressed.size());
+      std::copy(uncompressed.begin(),
+                uncompressed.end(),
+                uncompressed_columns.begin());
+    }
+#endif
+
     /* Compute the data exchange pattern: */
 
     if (sparsity.n_rows() > n_locally_owned_dofs) {
@@ -265,12 +353,172 @@ namespace ryujin
         send_targets[p].second = entries_to_be_sent.size();
       }
     }
+
+#ifdef SHARED_MEMORY_EXCHANGE
+    /* This is a no-op unless the MPI communicator changed: */
+    node_communicator.reinit(mpi_communicator);
+
+    /*
+     * Communicate the offset of every message within entries_to_be_sent
+     * to the receiving MPI rank:
+     */
+
+    receive_offsets.resize(receive_targets.size());
+    std::vector<unsigned int> send_offsets(send_targets.size());
+    std::vector<MPI_Request> requests(receive_targets.size() +
+                                      send_targets.size());
+
+    for (unsigned int p = 0; p < receive_targets.size(); ++p) {
+      const int ierr = MPI_Irecv(&receive_offsets[p],
+                                 1,
+                                 MPI_UNSIGNED,
+                                 receive_targets[p].first,
+                                 dealii::Utilities::MPI::internal::Tags::
+                                     partitioner_export_start,
+                                 mpi_communicator,
+                                 &requests[p]);
+      AssertThrowMPI(ierr);
+    }
+
+    for (unsigned int p = 0; p < send_targets.size(); ++p) {
+      send_offsets[p] = (p == 0 ? 0 : send_targets[p - 1].second);
+      const int ierr = MPI_Isend(&send_offsets[p],
+                                 1,
+                                 MPI_UNSIGNED,
+                                 send_targets[p].first,
+                                 dealii::Utilities::MPI::internal::Tags::
+                                     partitioner_export_start,
+                                 mpi_communicator,
+                                 &requests[receive_targets.size() + p]);
+      AssertThrowMPI(ierr);
+    }
+
+    const int ierr =
+        MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+    AssertThrowMPI(ierr);
+#endif
+  }
+
+
+  template <int simd_length>
+  EdgeListSIMD<simd_length>::EdgeListSIMD()
+      : n_internal_dofs(0)
+      , row_starts(1)
+      , n_edges_(0)
+  {
+  }
+
+
+  template <int simd_length>
+  template <typename T>
+  void SparsityPatternSIMD<simd_length>::first_touch(
+      dealii::AlignedVector<T> &array, const unsigned int n_components) const
+  {
+    resize_for_first_touch(array, n_nonzero_elements() * n_components);
+
+    const auto n_rows = this->n_rows();
+    T *data = array.data();
+
+    const auto fill_simd_rows = [&](const unsigned int left,
+                                    const unsigned int right) {
+      RYUJIN_OMP_FOR_NOWAIT
+      for (unsigned int i = left; i < right; i += simd_length)
+        std::fill(data + row_starts[i / simd_length] * n_components,
+                  data + row_starts[i / simd_length + 1] * n_components,
+                  T(0));
+    };
+
+    RYUJIN_PARALLEL_REGION_BEGIN
+
+    RYUJIN_OMP_FOR_NOWAIT
+    for (unsigned int i = n_internal_dofs; i < n_locally_owned_dofs; ++i)
+      std::fill(data + row_starts[i] * n_components,
+                data + row_starts[i + 1] * n_components,
+                T(0));
+
+    /* Same split (and static schedule) as the HyperbolicModule loops: */
+    fill_simd_rows(0, n_export_indices);
+    fill_simd_rows(n_export_indices, n_internal_dofs);
+
+    RYUJIN_OMP_FOR_NOWAIT
+    for (unsigned int i = n_locally_owned_dofs; i < n_rows; ++i)
+      std::fill(data + row_starts[i] * n_components,
+                data + row_starts[i + 1] * n_components,
+                T(0));
+
+    RYUJIN_PARALLEL_REGION_END
+  }
+
+
+  template <int simd_length>
+  void EdgeListSIMD<simd_length>::reinit(
+      const SparsityPatternSIMD<simd_length> &sparsity)
+  {
+    n_internal_dofs = sparsity.n_internal_dofs;
+    const unsigned int n_locally_owned_dofs = sparsity.n_locally_owned_dofs;
+
+    std::vector<unsigned int> positions;
+    std::vector<unsigned int> lane_masks;
+    n_edges_ = 0;
+
+    row_starts.resize_fast(n_locally_owned_dofs + 1);
+    row_starts[0] = 0;
+
+    /* Vectorized part: */
+
+    for (unsigned int i = 0; i < n_internal_dofs; i += simd_length) {
+      const unsigned int row_length = sparsity.row_length(i);
+
+      const unsigned int *js = sparsity.columns(i);
+      for (unsigned int col_idx = 0; col_idx < row_length;
+           ++col_idx, js += simd_length) {
+
+        unsigned int lane_mask = 0;
+        for (unsigned int k = 0; k < simd_length; ++k)
+          if (js[k] > i + k) {
+            lane_mask |= (1u << k);
+            ++n_edges_;
+          }
+
+        if (lane_mask != 0) {
+          positions.push_back(col_idx);
+          lane_masks.push_back(lane_mask);
+        }
+      }
+
+      row_starts[i / simd_length + 1] = positions.size();
+    }
+
+    /* Rest: */
+
+    row_starts[n_internal_dofs] = row_starts[n_internal_dofs / simd_length];
+
+    for (unsigned int i = n_internal_dofs; i < n_locally_owned_dofs; ++i) {
+      const unsigned int row_length = sparsity.row_length(i);
+
+      const unsigned int *js = sparsity.columns(i);
+      for (unsigned int col_idx = 0; col_idx < row_length; ++col_idx, ++js) {
+        if (*js > i) {
+          positions.push_back(col_idx);
+          lane_masks.push_back(1u);
+          ++n_edges_;
+        }
+      }
+
+      row_starts[i + 1] = positions.size();
+    }
+
+    batch_positions.resize_fast(positions.size());
+    std::copy(positions.begin(), positions.end(), batch_positions.begin());
+    batch_lane_masks.resize_fast(lane_masks.size());
+    std::copy(lane_masks.begin(), lane_masks.end(), batch_lane_masks.begin());
   }
 
 
   template <typename Number, int n_components, int simd_length>
   SparseMatrixSIMD<Number, n_components, simd_length>::SparseMatrixSIMD()
       : sparsity(nullptr)
+      , active_channel(0)
   {
   }
 
@@ -279,17 +527,39 @@ namespace ryujin
   SparseMatrixSIMD<Number, n_components, simd_length>::SparseMatrixSIMD(
       const SparsityPatternSIMD<simd_length> &sparsity)
       : sparsity(&sparsity)
+      , active_channel(0)
   {
-    data.resize(sparsity.n_nonzero_elements() * n_components);
+    reinit(sparsity);
   }
 
 
   template <typename Number, int n_components, int simd_length>
   void SparseMatrixSIMD<Number, n_components, simd_length>::reinit(
-      const SparsityPatternSIMD<simd_length> &sparsity)
+      const SparsityPatternSIMD<simd_length> &sparsity,
+      const bool mirror_transposed /*= false*/)
   {
     this->sparsity = &sparsity;
-    data.resize(sparsity.n_nonzero_elements() * n_components);
+
+    /* Persistent requests are bound to the old storage, release them: */
+    requests.clear();
+
+    /* Matrix entries are accumulated directly during assembly: */
+    sparsity.first_touch(data, n_components);
+
+    AssertThrow(!mirror_transposed || n_components == 1,
+                dealii::ExcMessage("Transpose-mirrored storage is only "
+                                   "supported for scalar matrices."));
+    if (mirror_transposed) {
+      sparsity.first_touch(transposed_data);
+    } else {
+      transposed_data.clear();
+    }
+
+#ifdef SHARED_MEMORY_EXCHANGE
+    shared_window.reinit(sparsity.node_communicator.communicator(),
+                         n_components * sparsity.entries_to_be_sent.size() *
+                             sizeof(Number));
+#endif
   }
 
 
@@ -413,4 +683,298 @@ namespace ryujin
     RYUJIN_PARALLEL_REGION_END
   }
 
+
+  template <typename Number, int n_components, int simd_length>
+  AntisymmetricSparseMatrixSIMD<Number, n_components, simd_length>::
+      AntisymmetricSparseMatrixSIMD()
+      : sparsity(nullptr)
+      , row_starts(1)
+  {
+  }
+
+
+  template <typename Number, int n_components, int simd_length>
+  void AntisymmetricSparseMatrixSIMD<Number, n_components, simd_length>::reinit(
+      const SparseMatrixSIMD<Number, n_components, simd_length> &matrix,
+      const Number tolerance /*= Number(1.0e-10)*/)
+  {
+    Assert(matrix.sparsity != nullptr, dealii::ExcNotInitialized());
+    sparsity = matrix.sparsity;
+
+    const unsigned int n_internal_dofs = sparsity->n_internal_dofs;
+    const unsigned int n_rows = sparsity->n_rows();
+
+    /*
+     * First pass: determine the number of leading positions (excluding
+     * the diagonal) of every SIMD row that can be reconstructed from the
+     * transposed entry:
+     */
+
+    n_omitted.resize(n_internal_dofs / simd_length);
+
+    RYUJIN_PARALLEL_REGION_BEGIN
+
+    RYUJIN_OMP_FOR
+    for (unsigned int i = 0; i < n_internal_dofs; i += simd_length) {
+      const unsigned int row_length = sparsity->row_length(i);
+
+      unsigned int col_idx = 1;
+      for (; col_idx < row_length; ++col_idx) {
+        bool omit = true;
+        for (unsigned int k = 0; k < simd_length && omit; ++k) {
+          const unsigned int j = sparsity->column(i + k, col_idx);
+          if (j >= i + k) {
+            omit = false;
+          } else {
+            const auto m_ij =
+                matrix.template get_tensor<Number>(i + k, col_idx);
+            const auto m_ji =
+                matrix.template get_transposed_tensor<Number>(i + k, col_idx);
+            omit = (m_ij + m_ji).norm() <= tolerance * m_ij.norm();
+          }
+        }
+        if (!omit)
+          break;
+      }
+
+      n_omitted[i / simd_length] = col_idx - 1;
+    }
+
+    RYUJIN_PARALLEL_REGION_END
+
+    /*
+     * Second pass: compute row starts of the stored entries and of the
+     * omitted offsets:
+     */
+
+    row_starts.resize(n_rows + 1);
+    omitted_starts.resize(n_internal_dofs / simd_length + 1);
+
+    row_starts[0] = 0;
+    omitted_starts[0] = 0;
+    for (unsigned int i = 0; i < n_internal_dofs; i += simd_length) {
+      const unsigned int simd_row = i / simd_length;
+      const unsigned int n_stored =
+          sparsity->row_length(i) - n_omitted[simd_row];
+      row_starts[simd_row + 1] = row_starts[simd_row] + n_stored * simd_length;
+      omitted_starts[simd_row + 1] =
+          omitted_starts[simd_row] + n_omitted[simd_row] * simd_length;
+    }
+
+    row_starts[n_internal_dofs] = row_starts[n_internal_dofs / simd_length];
+    for (unsigned int i = n_internal_dofs; i < n_rows; ++i)
+      row_starts[i + 1] = row_starts[i] + sparsity->row_length(i);
+
+    AssertThrow(row_starts.back() * n_components <
+                    std::numeric_limits<unsigned int>::max(),
+                dealii::ExcMessage("Omitted offsets only support up to 4 "
+                                   "billion matrix entries per MPI rank. Try to"
+                                   " split into smaller problems with MPI"));
+
+    data.resize_fast(row_starts.back() * n_components);
+    omitted_offsets.resize_fast(omitted_starts.back());
+
+    /*
+     * Third pass: copy all stored entries and record the offsets of the
+     * transposed entries of all omitted entries:
+     */
+
+    RYUJIN_PARALLEL_REGION_BEGIN
+
+    RYUJIN_OMP_FOR
+    for (unsigned int i = 0; i < n_internal_dofs; i += simd_length) {
+      const unsigned int simd_row = i / simd_length;
+      const unsigned int row_length = sparsity->row_length(i);
+      const unsigned int n = n_omitted[simd_row];
+
+      for (unsigned int col_idx = 0; col_idx < row_length; ++col_idx) {
+        if (col_idx == 0 || col_idx > n) {
+          const unsigned int position = col_idx == 0 ? 0 : col_idx - n;
+          const auto entry =
+              matrix.template get_tensor<VectorizedArray>(i, col_idx);
+          Number *store_pos =
+              data.data() +
+              (row_starts[simd_row] + position * simd_length) * n_components;
+          for (unsigned int d = 0; d < n_components; ++d)
+            entry[d].store(store_pos + d * simd_length);
+          continue;
+        }
+
+        for (unsigned int k = 0; k < simd_length; ++k) {
+          const std::size_t index =
+              sparsity->indices_transposed[sparsity->row_starts[simd_row] +
+                                           col_idx * simd_length + k];
+
+          /* The transposed entry is located in a stored position of row j: */
+          const unsigned int j = sparsity->column(i + k, col_idx);
+          Assert(j < i + k, dealii::ExcInternalError());
+          const unsigned int simd_row_j = j / simd_length;
+          const unsigned int simd_offset_j = j % simd_length;
+          const unsigned int col_idx_j =
+              (index - sparsity->row_starts[simd_row_j] - simd_offset_j) /
+              simd_length;
+          Assert(col_idx_j > n_omitted[simd_row_j], dealii::ExcInternalError());
+          const unsigned int position_j = col_idx_j - n_omitted[simd_row_j];
+
+          omitted_offsets[omitted_starts[simd_row] +
+                          (col_idx - 1) * simd_length + k] =
+              (row_starts[simd_row_j] + position_j * simd_length) *
+                  n_components +
+              simd_offset_j;
+        }
+      }
+    }
+
+    RYUJIN_OMP_FOR
+    for (unsigned int i = n_internal_dofs; i < n_rows; ++i) {
+      const unsigned int row_length = sparsity->row_length(i);
+      for (unsigned int col_idx = 0; col_idx < row_length; ++col_idx) {
+        const auto entry = matrix.template get_tensor<Number>(i, col_idx);
+        for (unsigned int d = 0; d < n_components; ++d)
+          data[(row_starts[i] + col_idx) * n_components + d] = entry[d];
+      }
+    }
+
+    RYUJIN_PARALLEL_REGION_END
+
+#ifdef DEBUG
+    /* Verify that all entries are reconstructed correctly: */
+    for (unsigned int i = 0; i < sparsity->n_locally_owned_dofs; ++i)
+      for (unsigned int col_idx = 0; col_idx < sparsity->row_length(i);
+           ++col_idx) {
+        const auto m_ij = matrix.template get_tensor<Number>(i, col_idx);
+        Assert((get_tensor<Number>(i, col_idx) - m_ij).norm() <=
+                   tolerance * m_ij.norm(),
+               dealii::ExcInternalError());
+      }
+#endif
+  }
+
+
+  template <typename Number, int n_components, int simd_length>
+  StencilSparseMatrixSIMD<Number, n_components, simd_length>::
+      StencilSparseMatrixSIMD()
+      : sparsity(nullptr)
+      , n_stencils_(0)
+      , compressed_(false)
+  {
+  }
+
+
+  template <typename Number, int n_components, int simd_length>
+  void StencilSparseMatrixSIMD<Number, n_components, simd_length>::reinit(
+      SparseMatrixSIMD<Number, n_components, simd_length> &&matrix)
+  {
+    Assert(matrix.sparsity != nullptr, dealii::ExcNotInitialized());
+    sparsity = matrix.sparsity;
+
+    const unsigned int n_rows = sparsity->n_rows();
+
+    /*
+     * Hash every row over the bit pattern of its entries (FNV-1a). Rows
+     * with equal hash are compared entry by entry below, thus a hash
+     * collision never merges two distinct rows.
+     */
+
+    const auto bit_equal = [](const Number &a, const Number &b) {
+      return std::memcmp(&a, &b, sizeof(Number)) == 0;
+    };
+
+    std::vector<std::size_t> hashes(n_rows);
+
+    RYUJIN_PARALLEL_REGION_BEGIN
+
+    RYUJIN_OMP_FOR
+    for (unsigned int i = 0; i < n_rows; ++i) {
+      const unsigned int row_length = sparsity->row_length(i);
+
+      std::size_t hash = 14695981039346656037ull ^ row_length;
+      for (unsigned int col_idx = 0; col_idx < row_length; ++col_idx) {
+        const auto entry = matrix.template get_tensor<Number>(i, col_idx);
+        for (unsigned int d = 0; d < n_components; ++d) {
+          unsigned char bytes[sizeof(Number)];
+          std::memcpy(bytes, &entry[d], sizeof(Number));
+          for (const auto byte : bytes)
+            hash = (hash ^ byte) * 1099511628211ull;
+        }
+      }
+      hashes[i] = hash;
+    }
+
+    RYUJIN_PARALLEL_REGION_END
+
+    /*
+     * Build the stencil table. We stop as soon as the table (together
+     * with the row offsets) is no smaller than the assembled matrix.
+     */
+
+    const std::size_t full_size = matrix.data.size() * sizeof(Number);
+    const std::size_t offsets_size = n_rows * sizeof(unsigned int);
+
+    /* hash -> (offset into stencils, row length): */
+    std::unordered_multimap<std::size_t, std::pair<unsigned int, unsigned int>>
+        stencil_map;
+
+    row_offsets.resize_fast(n_rows);
+    stencils.clear();
+    n_stencils_ = 0;
+    compressed_ = true;
+
+    for (unsigned int i = 0; i < n_rows && compressed_; ++i) {
+      const unsigned int row_length = sparsity->row_length(i);
+
+      const auto equal_to_row = [&](const auto &candidate) {
+        const auto [offset, length] = candidate.second;
+        if (length != row_length)
+          return false;
+        for (unsigned int col_idx = 0; col_idx < row_length; ++col_idx) {
+          const auto entry = matrix.template get_tensor<Number>(i, col_idx);
+          for (unsigned int d = 0; d < n_components; ++d)
+            if (!bit_equal(entry[d],
+                           stencils[offset + col_idx * n_components + d]))
+              return false;
+        }
+        return true;
+      };
+
+      const auto [begin, end] = stencil_map.equal_range(hashes[i]);
+      const auto it = std::find_if(begin, end, equal_to_row);
+      if (it != end) {
+        row_offsets[i] = it->second.first;
+        continue;
+      }
+
+      if (stencils.size() + row_length * n_components >=
+              std::numeric_limits<unsigned int>::max() ||
+          (stencils.size() + row_length * n_components) * sizeof(Number) +
+                  offsets_size >=
+              full_size) {
+        compressed_ = false;
+        break;
+      }
+
+      const auto offset = static_cast<unsigned int>(stencils.size());
+      for (unsigned int col_idx = 0; col_idx < row_length; ++col_idx) {
+        const auto entry = matrix.template get_tensor<Number>(i, col_idx);
+        for (unsigned int d = 0; d < n_components; ++d)
+          stencils.push_back(entry[d]);
+      }
+      stencil_map.emplace(hashes[i], std::make_pair(offset, row_length));
+      row_offsets[i] = offset;
+      ++n_stencils_;
+    }
+
+    if (compressed_) {
+      /* Release the assembled matrix: */
+      matrix = SparseMatrixSIMD<Number, n_components, simd_length>();
+      full_matrix = SparseMatrixSIMD<Number, n_components, simd_length>();
+    } else {
+      /* Keep the assembled matrix: */
+      row_offsets.clear();
+      stencils.clear();
+      n_stencils_ = 0;
+      full_matrix = std::move(matrix);
+    }
+  }
+
 } // namespace ryujin
@@ -34,6 +34,19 @@ namespace ryujin
      * warning is emitted.
      */
     bang_bang_control,
+
+    /**
+     * Adapt the CFL number smoothly from time step to time step. The CFL
+     * number is driven towards a target value slightly below the lowest
+     * CFL number at which an invariant domain and or CFL condition
+     * violation has been recently observed by a PI controller operating on
+     * the logarithm of the CFL number. The observed violation threshold is
+     * slowly relaxed after every successful time step so that the
+     * controller probes larger CFL numbers again. In case of a violation
+     * the time step is repeated with a reduced CFL number. If this fails
+     * with "cfl min" a warning is emitted.
+     */
+    adaptive_control,
   };
 
 
@@ -71,6 +84,41 @@ namespace ryujin
      */
     ssprk_33,
 
+    /**
+     * The low-storage strong stability preserving Runge Kutta method of
+     * order 2 with four stages, SSPRK(4,2;3/4), in Shu-Osher form (with
+     * forward Euler substeps of step size \f$\tau\f$ and a combined step
+     * size of \f$3\tau\f$), see @cite Ketcheson2008:
+     * \f{align*}
+     *   U^{(i)} &= U^{(i-1)} + \tau L(U^{(i-1)}),\quad i=1,2,3,
+     *   \\
+     *   U^{n+1} &= \tfrac{1}{4} U^{n} + \tfrac{3}{4}\big(U^{(3)} + \tau
+     *   L(U^{(3)})\big),
+     * \f}
+     * with \f$U^{(0)} = U^n\f$. The scheme only requires two temporary
+     * state vectors independently of the number of stages.
+     */
+    ssprk_42,
+
+    /**
+     * The low-storage strong stability preserving Runge Kutta method of
+     * order 3 with four stages, SSPRK(4,3;1/2), in Shu-Osher form (with
+     * forward Euler substeps of step size \f$\tau\f$ and a combined step
+     * size of \f$2\tau\f$), see @cite Ketcheson2008:
+     * \f{align*}
+     *   U^{(1)} &= U^{n} + \tau L(U^{n}),
+     *   \\
+     *   U^{(2)} &= U^{(1)} + \tau L(U^{(1)}),
+     *   \\
+     *   U^{(3)} &= \tfrac{2}{3} U^{n} + \tfrac{1}{3}\big(U^{(2)} + \tau
+     *   L(U^{(2)})\big),
+     *   \\
+     *   U^{n+1} &= U^{(3)} + \tau L(U^{(3)}).
+     * \f}
+     * The scheme only requires two temporary state vectors.
+     */
+    ssprk_43,
+
     /**
      * The explicit Runge-Kutta method RK(1,1;1), aka a simple, forward
      * Euler step.
@@ -148,12 +196,16 @@ namespace ryujin
 DECLARE_ENUM(ryujin::CFLRecoveryStrategy,
              LIST({ryujin::CFLRecoveryStrategy::none, "none"},
                   {ryujin::CFLRecoveryStrategy::bang_bang_control,
-                   "bang bang control"}));
+                   "bang bang control"},
+                  {ryujin::CFLRecoveryStrategy::adaptive_control,
+                   "adaptive control"}));
 
 DECLARE_ENUM(
     ryujin::TimeSteppingScheme,
     LIST({ryujin::TimeSteppingScheme::ssprk_22, "ssprk 22"},
          {ryujin::TimeSteppingScheme::ssprk_33, "ssprk 33"},
+         {ryujin::TimeSteppingScheme::ssprk_42, "ssprk 42"},
+         {ryujin::TimeSteppingScheme::ssprk_43, "ssprk 43"},
          {ryujin::TimeSteppingScheme::erk_11, "erk 11"},
          {ryujin::TimeSteppingScheme::erk_22, "erk 22"},
          {ryujin::TimeSteppingScheme::erk_33, "erk 33"},
@@ -246,6 +298,26 @@ namespace ryujin
      */
     ACCESSOR_READ_ONLY(efficiency);
 
+    /**
+     * The number of accepted time steps.
+     */
+    ACCESSOR_READ_ONLY(n_accepted_steps);
+
+    /**
+     * The number of rejected (and thus wasted) time step attempts that had
+     * to be repeated with a reduced CFL number.
+     */
+    ACCESSOR_READ_ONLY(n_rejected_steps);
+
+    /**
+     * The average CFL number of all accepted time steps.
+     */
+    Number average_cfl() const
+    {
+      return n_accepted_steps_ == 0 ? Number(0.)
+                                    : cfl_sum_ / Number(n_accepted_steps_);
+    }
+
   protected:
     /**
      * Given a reference to a previous state vector U performs an explicit
@@ -271,6 +343,22 @@ namespace ryujin
      */
     Number step_ssprk_33(StateVector &state_vector, Number t);
 
+    /**
+     * Given a reference to a previous state vector U performs an explicit
+     * low-storage second-order strong-stability preserving Runge-Kutta
+     * SSPRK(4,2;3/4) time step (and store the result in U). The function
+     * returns the chosen time step size tau.
+     */
+    Number step_ssprk_42(StateVector &state_vector, Number t);
+
+    /**
+     * Given a reference to a previous state vector U performs an explicit
+     * low-storage third-order strong-stability preserving Runge-Kutta
+     * SSPRK(4,3;1/2) time step (and store the result in U). The function
+     * returns the chosen time step size tau.
+     */
+    Number step_ssprk_43(StateVector &state_vector, Number t);
+
     /**
      * Given a reference to a previous state vector U performs an explicit
      * first-order Euler step ERK(1,1;1) time step (and store the result
@@ -346,6 +434,11 @@ namespace ryujin
 
     CFLRecoveryStrategy cfl_recovery_strategy_;
 
+    Number cfl_controller_safety_factor_;
+    Number cfl_controller_proportional_gain_;
+    Number cfl_controller_integral_gain_;
+    Number cfl_controller_relaxation_;
+
     TimeSteppingScheme time_stepping_scheme_;
     double efficiency_;
 
@@ -367,6 +460,21 @@ namespace ryujin
 
     std::vector<StateVector> temp_;
 
+    Number cfl_current_;
+    Number cfl_threshold_;
+    Number cfl_error_last_;
+
+    unsigned int n_accepted_steps_;
+    unsigned int n_rejected_steps_;
+    Number cfl_sum_;
+
+    /**
+     * Update the CFL number of the adaptive controller after a time step
+     * attempt with the current CFL number. The parameter @p rejected
+     * indicates whether the attempt was rejected.
+     */
+    void adapt_cfl(const bool rejected);
+
     //@}
   };
 
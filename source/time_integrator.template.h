@@ -37,6 +37,9 @@ namespace ryujin
       , offline_data_(&offline_data)
       , hyperbolic_module_(&hyperbolic_module)
       , parabolic_module_(&parabolic_module)
+      , n_accepted_steps_(0)
+      , n_rejected_steps_(0)
+      , cfl_sum_(0.)
   {
     cfl_min_ = Number(0.45);
     add_parameter(
@@ -56,7 +59,32 @@ namespace ryujin
     add_parameter("cfl recovery strategy",
                   cfl_recovery_strategy_,
                   "CFL/invariant domain violation recovery strategy: none, "
-                  "bang bang control");
+                  "bang bang control, adaptive control");
+
+    cfl_controller_safety_factor_ = Number(0.8);
+    add_parameter("cfl controller safety factor",
+                  cfl_controller_safety_factor_,
+                  "Adaptive control: the controller targets this fraction of "
+                  "the lowest CFL number at which a violation was observed. "
+                  "A rejected time step is repeated with the CFL number "
+                  "reduced by this factor");
+
+    cfl_controller_proportional_gain_ = Number(0.2);
+    add_parameter("cfl controller proportional gain",
+                  cfl_controller_proportional_gain_,
+                  "Adaptive control: proportional gain of the PI controller");
+
+    cfl_controller_integral_gain_ = Number(0.3);
+    add_parameter("cfl controller integral gain",
+                  cfl_controller_integral_gain_,
+                  "Adaptive control: integral gain of the PI controller");
+
+    cfl_controller_relaxation_ = Number(0.01);
+    add_parameter("cfl controller relaxation",
+                  cfl_controller_relaxation_,
+                  "Adaptive control: relative amount by which the observed "
+                  "violation threshold is relaxed after every accepted time "
+                  "step");
 
     if (ParabolicSystem::is_identity)
       time_stepping_scheme_ = TimeSteppingScheme::erk_33;
@@ -64,9 +92,9 @@ namespace ryujin
       time_stepping_scheme_ = TimeSteppingScheme::strang_erk_33_cn;
     add_parameter("time stepping scheme",
                   time_stepping_scheme_,
-                  "Time stepping scheme: ssprk 22, ssprk 33, erk 11, erk 22, "
-                  "erk 33, erk 43, erk "
-                  "54, strang ssprk 33 cn, strang erk 33 cn, strang erk 43 cn");
+                  "Time stepping scheme: ssprk 22, ssprk 33, ssprk 42, ssprk 43, "
+                  "erk 11, erk 22, erk 33, erk 43, erk 54, strang ssprk 33 cn, "
+                  "strang erk 33 cn, strang erk 43 cn");
   }
 
 
@@ -88,6 +116,14 @@ namespace ryujin
       temp_.resize(2);
       efficiency_ = 1.;
       break;
+    case TimeSteppingScheme::ssprk_42:
+      temp_.resize(2);
+      efficiency_ = 3.;
+      break;
+    case TimeSteppingScheme::ssprk_43:
+      temp_.resize(2);
+      efficiency_ = 2.;
+      break;
     case TimeSteppingScheme::erk_11:
       temp_.resize(1);
       efficiency_ = 1.;
@@ -136,6 +172,16 @@ namespace ryujin
 
     hyperbolic_module_->cfl(cfl_max_);
 
+    AssertThrow(cfl_controller_safety_factor_ > 0. &&
+                    cfl_controller_safety_factor_ < 1.,
+                ExcMessage("cfl controller safety factor must be in (0,1)"));
+    AssertThrow(cfl_controller_relaxation_ >= 0.,
+                ExcMessage("cfl controller relaxation must be nonnegative"));
+
+    cfl_current_ = cfl_max_;
+    cfl_threshold_ = cfl_max_ / cfl_controller_safety_factor_;
+    cfl_error_last_ = 0.;
+
     const auto check_whether_timestepping_makes_sense = [&]() {
       /*
        * Make sure the user selects an appropriate time-stepping scheme.
@@ -146,6 +192,10 @@ namespace ryujin
         [[fallthrough]];
       case TimeSteppingScheme::ssprk_33:
         [[fallthrough]];
+      case TimeSteppingScheme::ssprk_42:
+        [[fallthrough]];
+      case TimeSteppingScheme::ssprk_43:
+        [[fallthrough]];
       case TimeSteppingScheme::erk_11:
         [[fallthrough]];
       case TimeSteppingScheme::erk_22:
@@ -199,6 +249,10 @@ namespace ryujin
         return step_ssprk_22(state_vector, t);
       case TimeSteppingScheme::ssprk_33:
         return step_ssprk_33(state_vector, t);
+      case TimeSteppingScheme::ssprk_42:
+        return step_ssprk_42(state_vector, t);
+      case TimeSteppingScheme::ssprk_43:
+        return step_ssprk_43(state_vector, t);
       case TimeSteppingScheme::erk_11:
         return step_erk_11(state_vector, t);
       case TimeSteppingScheme::erk_22:
@@ -220,6 +274,40 @@ namespace ryujin
       }
     };
 
+    const auto accept = [&](const Number tau) {
+      n_accepted_steps_++;
+      cfl_sum_ += hyperbolic_module_->cfl();
+      return tau;
+    };
+
+    if (cfl_recovery_strategy_ == CFLRecoveryStrategy::adaptive_control) {
+      hyperbolic_module_->begin_time_step(/*restart*/ false);
+
+      /*
+       * Repeat the time step with a successively reduced CFL number until
+       * it succeeds. The last attempt with "cfl min" only emits warnings:
+       */
+      for (;;) {
+        const auto strategy = cfl_current_ > cfl_min_
+                                  ? IDViolationStrategy::raise_exception
+                                  : IDViolationStrategy::warn;
+        hyperbolic_module_->id_violation_strategy_ = strategy;
+        parabolic_module_->id_violation_strategy_ = strategy;
+        hyperbolic_module_->cfl(cfl_current_);
+
+        try {
+          const auto tau = accept(single_step());
+          adapt_cfl(/*rejected*/ false);
+          return tau;
+
+        } catch (Restart) {
+          n_rejected_steps_++;
+          adapt_cfl(/*rejected*/ true);
+          hyperbolic_module_->begin_time_step(/*restart*/ true);
+        }
+      }
+    }
+
     if (cfl_recovery_strategy_ == CFLRecoveryStrategy::bang_bang_control) {
       hyperbolic_module_->id_violation_strategy_ =
           IDViolationStrategy::raise_exception;
@@ -229,18 +317,22 @@ namespace ryujin
     }
 
     try {
-      return single_step();
+      hyperbolic_module_->begin_time_step(/*restart*/ false);
+      return accept(single_step());
 
     } catch (Restart) {
 
       AssertThrow(cfl_recovery_strategy_ != CFLRecoveryStrategy::none,
                   dealii::ExcInternalError());
 
+      n_rejected_steps_++;
+
       if (cfl_recovery_strategy_ == CFLRecoveryStrategy::bang_bang_control) {
         hyperbolic_module_->id_violation_strategy_ = IDViolationStrategy::warn;
         parabolic_module_->id_violation_strategy_ = IDViolationStrategy::warn;
         hyperbolic_module_->cfl(cfl_min_);
-        return single_step();
+        hyperbolic_module_->begin_time_step(/*restart*/ true);
+        return accept(single_step());
       }
 
       __builtin_unreachable();
@@ -248,6 +340,41 @@ namespace ryujin
   }
 
 
+  template <typename Description, int dim, typename Number>
+  void TimeIntegrator<Description, dim, Number>::adapt_cfl(const bool rejected)
+  {
+    const auto safety = cfl_controller_safety_factor_;
+
+    if (rejected) {
+      /*
+       * Record the violation threshold, reset the controller memory, and
+       * repeat the time step with a reduced CFL number:
+       */
+      cfl_threshold_ = cfl_current_;
+      cfl_error_last_ = 0.;
+      cfl_current_ = std::max(cfl_min_, safety * cfl_current_);
+      return;
+    }
+
+    /*
+     * Slowly relax the violation threshold and drive the CFL number
+     * towards the target value with a PI controller (in velocity form)
+     * acting on the logarithm of the CFL number:
+     */
+
+    const auto relaxation = Number(1.) + cfl_controller_relaxation_;
+    cfl_threshold_ = std::min(cfl_max_ / safety, cfl_threshold_ * relaxation);
+    const Number cfl_target = std::min(cfl_max_, safety * cfl_threshold_);
+
+    const Number error = std::log(cfl_target / cfl_current_);
+    cfl_current_ *= std::exp(cfl_controller_proportional_gain_ *
+                                 (error - cfl_error_last_) +
+                             cfl_controller_integral_gain_ * error);
+    cfl_current_ = std::clamp(cfl_current_, cfl_min_, cfl_max_);
+    cfl_error_last_ = error;
+  }
+
+
   template <typename Description, int dim, typename Number>
   Number TimeIntegrator<Description, dim, Number>::step_ssprk_22(
       StateVector &state_vector, Number t)
@@ -301,6 +428,76 @@ namespace ryujin
   }
 
 
+  template <typename Description, int dim, typename Number>
+  Number TimeIntegrator<Description, dim, Number>::step_ssprk_42(
+      StateVector &state_vector, Number t)
+  {
+    /* Low-storage SSPRK(4,2), see @cite Ketcheson2008. */
+
+#ifdef DEBUG_OUTPUT
+    std::cout << "TimeIntegrator<dim, Number>::step_ssprk_42()" << std::endl;
+#endif
+
+    /* Step 1: T0 = U_old + tau * L(U_old) at time t -> t + tau */
+    hyperbolic_module_->prepare_state_vector(state_vector, t);
+    Number tau =
+        hyperbolic_module_->template step<0>(state_vector, {}, {}, temp_[0]);
+
+    /* Step 2: T1 = T0 + tau L(T0) at time t + tau -> t + 2*tau */
+    hyperbolic_module_->prepare_state_vector(temp_[0], t + 1.0 * tau);
+    hyperbolic_module_->template step<0>(temp_[0], {}, {}, temp_[1], tau);
+
+    /* Step 3: T0 = T1 + tau L(T1) at time t + 2*tau -> t + 3*tau */
+    hyperbolic_module_->prepare_state_vector(temp_[1], t + 2.0 * tau);
+    hyperbolic_module_->template step<0>(temp_[1], {}, {}, temp_[0], tau);
+
+    /* Step 4: T1 = T0 + tau L(T0) at time t + 3*tau -> t + 4*tau */
+    hyperbolic_module_->prepare_state_vector(temp_[0], t + 3.0 * tau);
+    hyperbolic_module_->template step<0>(temp_[0], {}, {}, temp_[1], tau);
+
+    /* Step 5: convex combination T1 = 1/4 U_old + 3/4 T1 at time t + 3*tau */
+    sadd(temp_[1], Number(3.0 / 4.0), Number(1.0 / 4.0), state_vector);
+
+    state_vector.swap(temp_[1]);
+    return 3. * tau;
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  Number TimeIntegrator<Description, dim, Number>::step_ssprk_43(
+      StateVector &state_vector, Number t)
+  {
+    /* Low-storage SSPRK(4,3), see @cite Ketcheson2008. */
+
+#ifdef DEBUG_OUTPUT
+    std::cout << "TimeIntegrator<dim, Number>::step_ssprk_43()" << std::endl;
+#endif
+
+    /* Step 1: T0 = U_old + tau * L(U_old) at time t -> t + tau */
+    hyperbolic_module_->prepare_state_vector(state_vector, t);
+    Number tau =
+        hyperbolic_module_->template step<0>(state_vector, {}, {}, temp_[0]);
+
+    /* Step 2: T1 = T0 + tau L(T0) at time t + tau -> t + 2*tau */
+    hyperbolic_module_->prepare_state_vector(temp_[0], t + 1.0 * tau);
+    hyperbolic_module_->template step<0>(temp_[0], {}, {}, temp_[1], tau);
+
+    /* Step 3: T0 = T1 + tau L(T1) at time t + 2*tau -> t + 3*tau */
+    hyperbolic_module_->prepare_state_vector(temp_[1], t + 2.0 * tau);
+    hyperbolic_module_->template step<0>(temp_[1], {}, {}, temp_[0], tau);
+
+    /* Step 4: convex combination T0 = 2/3 U_old + 1/3 T0 at time t + tau */
+    sadd(temp_[0], Number(1.0 / 3.0), Number(2.0 / 3.0), state_vector);
+
+    /* Step 5: T1 = T0 + tau L(T0) at time t + tau -> t + 2*tau */
+    hyperbolic_module_->prepare_state_vector(temp_[0], t + 1.0 * tau);
+    hyperbolic_module_->template step<0>(temp_[0], {}, {}, temp_[1], tau);
+
+    state_vector.swap(temp_[1]);
+    return 2. * tau;
+  }
+
+
   template <typename Description, int dim, typename Number>
   Number TimeIntegrator<Description, dim, Number>::step_erk_11(
       StateVector &state_vector, Number t)
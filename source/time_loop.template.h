@@ -15,8 +15,15 @@
 #include <deal.II/numerics/vector_tools.h>
 #include <deal.II/numerics/vector_tools.templates.h>
 
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+#include <filesystem>
 #include <fstream>
 #include <iomanip>
+#include <map>
+#include <type_traits>
 
 using namespace dealii;
 
@@ -26,7 +33,15 @@ namespace ryujin
   TimeLoop<Description, dim, Number>::TimeLoop(const MPI_Comm &mpi_comm)
       : ParameterAcceptor("/A - TimeLoop")
       , mpi_communicator_(mpi_comm)
-      , hyperbolic_system_("/B - Equation")
+      , hyperbolic_system_([&]() -> HyperbolicSystem {
+        /* Hand the communicator to systems that read data collectively: */
+        if constexpr (std::is_constructible_v<HyperbolicSystem,
+                                              std::string,
+                                              MPI_Comm>)
+          return HyperbolicSystem("/B - Equation", mpi_communicator_);
+        else
+          return HyperbolicSystem("/B - Equation");
+      }())
       , parabolic_system_("/B - Equation")
       , discretization_(mpi_communicator_, "/C - Discretization")
       , offline_data_(mpi_communicator_, discretization_, "/D - OfflineData")
@@ -226,6 +241,7 @@ namespace ryujin
       logfile_.open(base_name_ + ".log");
 
     print_parameters(logfile_);
+    print_thread_placement(logfile_);
 
     /*
      * Prepare data structures:
@@ -242,6 +258,7 @@ namespace ryujin
       print_info("preparing compute kernels");
 
       offline_data_.prepare(problem_dimension, n_precomputed_values);
+      initial_values_.prepare();
       hyperbolic_module_.prepare();
       parabolic_module_.prepare();
       time_integrator_.prepare();
@@ -733,6 +750,78 @@ namespace ryujin
   }
 
 
+  template <typename Description, int dim, typename Number>
+  void TimeLoop<Description, dim, Number>::print_thread_placement(
+      std::ostream &stream)
+  {
+    /*
+     * Record the CPU every OpenMP thread runs on and look up the
+     * corresponding NUMA node in sysfs. The information is necessarily
+     * only a snapshot: unless threads are pinned (for example with
+     * OMP_PROC_BIND=close and OMP_PLACES=cores) the operating system is
+     * free to migrate threads later on, which defeats the first-touch
+     * placement of the sparse matrices.
+     */
+
+    std::map<unsigned int, int> thread_to_cpu;
+
+    RYUJIN_PARALLEL_REGION_BEGIN
+#ifdef __linux__
+    const int cpu = sched_getcpu();
+#else
+    const int cpu = -1;
+#endif
+#ifdef WITH_OPENMP
+    const unsigned int thread = omp_get_thread_num();
+#else
+    const unsigned int thread = 0;
+#endif
+    RYUJIN_OMP_CRITICAL
+    thread_to_cpu[thread] = cpu;
+    RYUJIN_PARALLEL_REGION_END
+
+    const auto numa_node = [](const int cpu) -> int {
+      if (cpu < 0)
+        return -1;
+      namespace fs = std::filesystem;
+      std::error_code ec;
+      const fs::path path("/sys/devices/system/cpu/cpu" + std::to_string(cpu));
+      for (fs::directory_iterator it(path, ec), end; !ec && it != end;
+           it.increment(ec)) {
+        const auto name = it->path().filename().string();
+        if (name.rfind("node", 0) == 0 && name.size() > 4)
+          return std::stoi(name.substr(4));
+      }
+      return -1;
+    };
+
+    std::ostringstream output;
+    output << "    p" << mpi_rank_ << " on "
+           << dealii::Utilities::System::get_hostname();
+#ifdef WITH_OPENMP
+    static const char *policies[] = {
+        "false", "true", "master", "close", "spread"};
+    const auto policy = omp_get_proc_bind();
+    output << " (proc_bind: "
+           << (policy >= 0 && policy < 5 ? policies[policy] : "unknown")
+           << ")";
+#endif
+    output << ":";
+    for (const auto &[thread, cpu] : thread_to_cpu)
+      output << " t" << thread << "->cpu" << cpu << "/numa" << numa_node(cpu);
+
+    const auto placements =
+        Utilities::MPI::gather(mpi_communicator_, output.str());
+
+    if (mpi_rank_ != 0)
+      return;
+
+    stream << std::endl << "Thread placement:" << std::endl;
+    for (const auto &it : placements)
+      stream << it << std::endl;
+  }
+
+
   template <typename Description, int dim, typename Number>
   void TimeLoop<Description, dim, Number>::print_memory_statistics(
       std::ostream &stream)
@@ -743,6 +832,13 @@ namespace ryujin
     Utilities::MPI::MinMaxAvg data =
         Utilities::MPI::min_max_avg(stats.VmRSS / 1024., mpi_communicator_);
 
+    Utilities::MPI::MinMaxAvg peak =
+        Utilities::MPI::min_max_avg(stats.VmHWM / 1024., mpi_communicator_);
+
+    Utilities::MPI::MinMaxAvg released = Utilities::MPI::min_max_avg(
+        offline_data_.released_sparsity_pattern_memory() / 1024. / 1024.,
+        mpi_communicator_);
+
     if (mpi_rank_ != 0)
       return;
 
@@ -750,12 +846,22 @@ namespace ryujin
 
     unsigned int n = dealii::Utilities::needed_digits(n_mpi_processes_);
 
-    output << "\nMemory:      [MiB]"                          //
-           << std::setw(8) << data.min                        //
-           << " [p" << std::setw(n) << data.min_index << "] " //
-           << std::setw(8) << data.avg << " "                 //
-           << std::setw(8) << data.max                        //
-           << " [p" << std::setw(n) << data.max_index << "]"; //
+    const auto print_snippet = [&output, n](const auto &values) {
+      output << std::setw(8) << values.min                        //
+             << " [p" << std::setw(n) << values.min_index << "] " //
+             << std::setw(8) << values.avg << " "                 //
+             << std::setw(8) << values.max                        //
+             << " [p" << std::setw(n) << values.max_index << "]"; //
+    };
+
+    output << "\nMemory:      [MiB]";
+    print_snippet(data);
+    output << "\n      peak:  [MiB]";
+    print_snippet(peak);
+    if (released.max > 0.) {
+      output << "\n  released:  [MiB]";
+      print_snippet(released);
+    }
 
     stream << output.str() << std::endl;
   }
@@ -970,6 +1076,18 @@ namespace ryujin
            << std::setprecision(0) << std::fixed << parabolic_module_.n_warnings()
            << " warn) ]" << std::endl;
 
+    const auto n_rejected = time_integrator_.n_rejected_steps();
+    const auto n_steps = time_integrator_.n_accepted_steps() + n_rejected;
+    output << "        [ "
+           << std::setprecision(0) << std::fixed << n_rejected
+           << "/"
+           << std::setprecision(0) << std::fixed << n_steps
+           << " wasted steps ("
+           << std::setprecision(1) << std::fixed << 100. * n_rejected / std::max(n_steps, 1u)
+           << "%) with avg. CFL = "
+           << std::setprecision(2) << std::fixed << time_integrator_.average_cfl()
+           << " ]" << std::endl;
+
     if constexpr (!ParabolicSystem::is_identity)
       parabolic_module_.print_solver_statistics(output);
 
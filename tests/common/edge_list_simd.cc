@@ -0,0 +1,85 @@
+#include <sparse_matrix_simd.h>
+#include <sparse_matrix_simd.template.h>
+
+#include <algorithm>
+
+/*
+ * Check that the EdgeListSIMD records every index pair (i,j) with j > i
+ * exactly once, and that writing edge values to the (i,j) and the
+ * transposed (j,i) entries results in a symmetric matrix. The output is
+ * independent of the SIMD width.
+ */
+
+int main()
+{
+  using VA = dealii::VectorizedArray<double>;
+  constexpr auto simd_width = VA::size();
+
+  dealii::DynamicSparsityPattern spars(14, 14);
+  spars.add(0, 0);
+  spars.add(0, 1);
+  spars.add(0, 13);
+  for (unsigned int i = 1; i < 12; ++i) {
+    spars.add(i, i - 1);
+    spars.add(i, i);
+    spars.add(i, i + 1);
+  }
+  spars.add(12, 12);
+  spars.add(12, 11);
+  spars.add(13, 13);
+  spars.add(13, 0);
+  spars.compress();
+
+  dealii::IndexSet locally_owned(14);
+  locally_owned.add_range(0, 14);
+  dealii::IndexSet locally_relevant(14);
+  auto partitioner = std::make_shared<dealii::Utilities::MPI::Partitioner>(
+      locally_owned, locally_relevant, MPI_COMM_SELF);
+
+  const unsigned int n_internal = (12 / simd_width) * simd_width;
+
+  ryujin::SparsityPatternSIMD<simd_width> my_sparsity(
+      n_internal, spars, partitioner);
+  ryujin::EdgeListSIMD<simd_width> my_edges;
+  my_edges.reinit(my_sparsity);
+  ryujin::SparseMatrixSIMD<double, 1, simd_width> my_sparse(my_sparsity);
+
+  std::vector<std::pair<unsigned int, unsigned int>> edges;
+
+  for (unsigned int i = 0; i < 14;) {
+    const unsigned int stride = my_sparsity.stride_of_row(i);
+    const unsigned int *positions = my_edges.positions(i);
+    const unsigned int *lane_masks = my_edges.lane_masks(i);
+
+    for (unsigned int b = 0; b < my_edges.n_batches(i); ++b) {
+      const unsigned int *js = my_sparsity.columns(i) + positions[b] * stride;
+      for (unsigned int k = 0; k < stride; ++k) {
+        if ((lane_masks[b] & (1u << k)) == 0)
+          continue;
+        edges.emplace_back(i + k, js[k]);
+        const double value = 100. * (i + k) + js[k];
+        my_sparse.write_entry(value, i + k, positions[b]);
+        my_sparse.write_transposed_entry(value, i + k, positions[b]);
+      }
+    }
+
+    i += stride;
+  }
+
+  std::sort(edges.begin(), edges.end());
+
+  std::cout << "Number of edges: " << my_edges.n_edges() << std::endl;
+  for (const auto &[i, j] : edges)
+    std::cout << "(" << i << ", " << j << ") ";
+  std::cout << std::endl;
+
+  std::cout << "Matrix entries row by row" << std::endl;
+  for (unsigned int i = 0; i < my_sparsity.n_rows(); ++i) {
+    for (unsigned int j = 1; j < my_sparsity.row_length(i); ++j) {
+      const auto a = my_sparse.get_entry(i, j);
+      const auto b = my_sparse.get_transposed_entry(i, j);
+      std::cout << a << (a == b ? " " : "(!) ");
+    }
+    std::cout << std::endl;
+  }
+}
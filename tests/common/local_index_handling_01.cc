@@ -0,0 +1,241 @@
+#include <local_index_handling.h>
+
+#include <deal.II/distributed/tria.h>
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/grid/grid_generator.h>
+
+#include <algorithm>
+#include <map>
+
+/*
+ * Check DoFRenumbering::regroup_scalar_range() on a locally refined mesh
+ * with hanging node constraints:
+ *
+ *  - the renumbering is a valid permutation of the locally owned index
+ *    range,
+ *  - the locally internal index range is left untouched,
+ *  - every appended group has a uniform stencil size, and the relative
+ *    order of indices with the same stencil size is preserved,
+ *  - the grouping survives a subsequent export_indices_first() pass,
+ *    i.e., all strides on both sides of the n_export_indices boundary
+ *    still have a uniform stencil size.
+ */
+
+using namespace dealii;
+
+constexpr int dim = 2;
+constexpr unsigned int group_size = 4;
+
+void create_sparsity_pattern(const DoFHandler<dim> &dof_handler,
+                             DynamicSparsityPattern &sparsity)
+{
+  const IndexSet &locally_owned = dof_handler.locally_owned_dofs();
+  IndexSet locally_relevant;
+  DoFTools::extract_locally_relevant_dofs(dof_handler, locally_relevant);
+
+  AffineConstraints<double> affine_constraints;
+  affine_constraints.reinit(locally_relevant);
+  DoFTools::make_hanging_node_constraints(dof_handler, affine_constraints);
+  affine_constraints.close();
+
+  sparsity.reinit(dof_handler.n_dofs(), dof_handler.n_dofs(), locally_relevant);
+  DoFTools::make_sparsity_pattern(
+      dof_handler, sparsity, affine_constraints, false);
+  SparsityTools::distribute_sparsity_pattern(
+      sparsity, locally_owned, MPI_COMM_WORLD, locally_relevant);
+}
+
+
+/* Return the length of the index range with uniform stencil per stride: */
+unsigned int consistent_stride_range(const DoFHandler<dim> &dof_handler,
+                                     const DynamicSparsityPattern &sparsity,
+                                     const unsigned int n_internal)
+{
+  const IndexSet &locally_owned = dof_handler.locally_owned_dofs();
+  const auto offset = *locally_owned.begin();
+
+  unsigned int i = 0;
+  for (; i < n_internal; ++i)
+    if (sparsity.row_length(offset + i) !=
+        sparsity.row_length(offset + i / group_size * group_size))
+      break;
+  return i / group_size * group_size;
+}
+
+
+/* Return the local index of every locally owned degree of freedom: */
+std::vector<unsigned int> owned_indices(const DoFHandler<dim> &dof_handler)
+{
+  const IndexSet &locally_owned = dof_handler.locally_owned_dofs();
+  const auto offset = *locally_owned.begin();
+
+  std::vector<unsigned int> result;
+  std::vector<types::global_dof_index> dof_indices(
+      dof_handler.get_fe().n_dofs_per_cell());
+  for (const auto &cell : dof_handler.active_cell_iterators()) {
+    if (!cell->is_locally_owned())
+      continue;
+    cell->get_dof_indices(dof_indices);
+    for (const auto index : dof_indices)
+      result.push_back(locally_owned.is_element(index)
+                           ? index - offset
+                           : numbers::invalid_unsigned_int);
+  }
+  return result;
+}
+
+
+int main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv);
+
+  const auto mpi_rank = Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+
+  parallel::distributed::Triangulation<dim> triangulation(MPI_COMM_WORLD);
+  GridGenerator::hyper_cube(triangulation);
+  triangulation.refine_global(4);
+
+  /* Refine the lower left quarter once more to create hanging nodes: */
+  for (const auto &cell : triangulation.active_cell_iterators())
+    if (cell->is_locally_owned() && cell->center()[0] < 0.5 &&
+        cell->center()[1] < 0.5)
+      cell->set_refine_flag();
+  triangulation.execute_coarsening_and_refinement();
+
+  DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(FE_Q<dim>(1));
+
+  const auto n_locally_owned = dof_handler.locally_owned_dofs().n_elements();
+
+  /* Set up the internal index range the same way OfflineData does: */
+
+  DynamicSparsityPattern sparsity;
+  create_sparsity_pattern(dof_handler, sparsity);
+
+  unsigned int n_internal = ryujin::DoFRenumbering::internal_range(
+      dof_handler, sparsity, group_size);
+  ryujin::DoFRenumbering::export_indices_first(
+      dof_handler, MPI_COMM_WORLD, n_internal, group_size);
+  create_sparsity_pattern(dof_handler, sparsity);
+
+  n_internal = ryujin::DoFRenumbering::inconsistent_strides_last(
+      dof_handler, sparsity, n_internal, group_size);
+  create_sparsity_pattern(dof_handler, sparsity);
+  n_internal = consistent_stride_range(dof_handler, sparsity, n_internal);
+
+  /* Record stencil sizes and numbering before the regrouping: */
+
+  const auto offset = *dof_handler.locally_owned_dofs().begin();
+  std::vector<unsigned int> row_length(n_locally_owned);
+  for (unsigned int i = 0; i < n_locally_owned; ++i)
+    row_length[i] = sparsity.row_length(offset + i);
+
+  const auto indices_before = owned_indices(dof_handler);
+
+  const unsigned int n_regrouped = ryujin::DoFRenumbering::regroup_scalar_range(
+      dof_handler, sparsity, n_internal, group_size);
+
+  const auto indices_after = owned_indices(dof_handler);
+
+  /* Reconstruct the permutation old -> new: */
+
+  bool permutation_valid = indices_before.size() == indices_after.size();
+  std::vector<unsigned int> new_index(n_locally_owned,
+                                      numbers::invalid_unsigned_int);
+  for (unsigned int k = 0; permutation_valid && k < indices_before.size();
+       ++k) {
+    const auto i = indices_before[k];
+    const auto j = indices_after[k];
+    if (i == numbers::invalid_unsigned_int ||
+        j == numbers::invalid_unsigned_int) {
+      permutation_valid &= (i == j);
+      continue;
+    }
+    permutation_valid &= (new_index[i] == numbers::invalid_unsigned_int ||
+                          new_index[i] == j);
+    new_index[i] = j;
+  }
+
+  std::vector<bool> seen(n_locally_owned, false);
+  for (const auto j : new_index) {
+    permutation_valid &= (j < n_locally_owned && !seen[j]);
+    if (j < n_locally_owned)
+      seen[j] = true;
+  }
+
+  bool internal_range_kept = true;
+  for (unsigned int i = 0; i < n_internal; ++i)
+    internal_range_kept &= (new_index[i] == i);
+
+  bool groups_uniform = n_regrouped % group_size == 0 &&
+                        n_regrouped >= n_internal &&
+                        n_regrouped <= n_locally_owned;
+
+  std::vector<unsigned int> old_index(n_locally_owned);
+  for (unsigned int i = 0; i < n_locally_owned; ++i)
+    if (new_index[i] < n_locally_owned)
+      old_index[new_index[i]] = i;
+
+  for (unsigned int j = n_internal; groups_uniform && j < n_regrouped; ++j)
+    groups_uniform &= (row_length[old_index[j]] ==
+                       row_length[old_index[j / group_size * group_size]]);
+
+  /*
+   * Stable: within each stencil size, complete groups and the remainder
+   * keep the relative order of the old numbering.
+   */
+
+  bool order_stable = true;
+  std::map<unsigned int, std::vector<unsigned int>> bins;
+  for (unsigned int i = n_internal; i < n_locally_owned; ++i)
+    bins[row_length[i]].push_back(new_index[i]);
+
+  for (const auto &[length, indices] : bins) {
+    const auto n_complete = indices.size() / group_size * group_size;
+    for (std::size_t k = 0; k < indices.size(); ++k) {
+      order_stable &= (k < n_complete) == (indices[k] < n_regrouped);
+      if (k > 0 && k != n_complete)
+        order_stable &= indices[k - 1] < indices[k];
+    }
+  }
+
+  /* Move export strides to the front again and rebuild the sparsity: */
+
+  const unsigned int n_export_indices =
+      ryujin::DoFRenumbering::export_indices_first(
+          dof_handler, MPI_COMM_WORLD, n_regrouped, group_size);
+  create_sparsity_pattern(dof_handler, sparsity);
+
+  const bool export_boundary_consistent =
+      n_export_indices % group_size == 0 && n_export_indices <= n_regrouped &&
+      consistent_stride_range(dof_handler, sparsity, n_regrouped) ==
+          n_regrouped;
+
+  const auto all = [](const bool value) {
+    return Utilities::MPI::min(static_cast<unsigned int>(value),
+                               MPI_COMM_WORLD) == 1;
+  };
+
+  const bool result_permutation = all(permutation_valid);
+  const bool result_internal = all(internal_range_kept);
+  const bool result_groups = all(groups_uniform);
+  const bool result_order = all(order_stable);
+  const bool result_export = all(export_boundary_consistent);
+
+  const auto n_regrouped_total =
+      Utilities::MPI::sum(n_regrouped - n_internal, MPI_COMM_WORLD);
+
+  if (mpi_rank == 0) {
+    const auto yes_no = [](const bool value) { return value ? "yes" : "no"; };
+    std::cout << "valid permutation:             " << yes_no(result_permutation)
+              << "\ninternal range unchanged:      " << yes_no(result_internal)
+              << "\nappended groups uniform:       " << yes_no(result_groups)
+              << "\nrelative order preserved:      " << yes_no(result_order)
+              << "\nstrides consistent after export_indices_first: "
+              << yes_no(result_export)
+              << "\nindices regrouped:             "
+              << (n_regrouped_total > 0 ? "yes" : "no") << std::endl;
+  }
+
+  return 0;
+}
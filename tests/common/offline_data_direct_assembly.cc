@@ -0,0 +1,135 @@
+#include <discretization.h>
+#include <offline_data.h>
+
+#include <deal.II/base/mpi.h>
+
+#include <iostream>
+#include <sstream>
+
+/*
+ * Compare the matrices that OfflineData::assemble() scatters directly
+ * into the SIMD storage (no affine constraints present) against the
+ * matrices assembled into intermediate sparse matrices and read in
+ * afterwards ("assemble directly = false"):
+ *
+ *  - mass matrix, lumped mass matrix and c_ij matrix
+ *  - block inverse mass matrix for a discontinuous ansatz
+ *  - measure of the computational domain
+ *
+ * All locally relevant rows are compared, i.e., including ghost rows.
+ * Both paths sum cell contributions in a different order, thus entries
+ * are compared up to a relative tolerance.
+ */
+
+using namespace ryujin;
+using namespace dealii;
+
+constexpr int dim = 2;
+using Number = double;
+
+constexpr double tolerance = 1.e-12;
+
+int main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  const MPI_Comm mpi_communicator(MPI_COMM_WORLD);
+
+  const auto mpi_rank = Utilities::MPI::this_mpi_process(mpi_communicator);
+
+  Discretization<dim> discretization(mpi_communicator, "/Discretization");
+  OfflineData<dim, Number> direct(mpi_communicator, discretization, "/Direct");
+  OfflineData<dim, Number> read_in(mpi_communicator, discretization, "/ReadIn");
+
+  for (const std::string ansatz : {"cG Q1", "cG Q2", "dG Q1"}) {
+    std::stringstream parameters;
+    parameters << "subsection Discretization\n"
+               << "set geometry = rectangular domain\n"
+               << "set mesh refinement = 3\n"
+               << "set finite element ansatz = " << ansatz << "\n"
+               << "end\n"
+               << "subsection ReadIn\n"
+               << "set assemble directly = false\n"
+               << "end" << std::endl;
+    ParameterAcceptor::initialize(parameters);
+
+    discretization.prepare("test");
+    direct.prepare(/*problem_dimension*/ 1, /*n_precomputed_values*/ 0);
+    read_in.prepare(/*problem_dimension*/ 1, /*n_precomputed_values*/ 0);
+
+    const auto &sparsity = direct.sparsity_pattern_simd();
+    const auto &sparsity_read_in = read_in.sparsity_pattern_simd();
+
+    bool same_pattern = sparsity.n_rows() == sparsity_read_in.n_rows();
+    double scale = 0.;
+    double mass_deviation = 0.;
+    double cij_deviation = 0.;
+    double inverse_deviation = 0.;
+    double lumped_deviation = 0.;
+
+    for (unsigned int i = 0; same_pattern && i < sparsity.n_rows(); ++i) {
+      same_pattern &= sparsity.row_length(i) == sparsity_read_in.row_length(i);
+      for (unsigned int p = 0; same_pattern && p < sparsity.row_length(i);
+           ++p) {
+        same_pattern &= sparsity.column(i, p) == sparsity_read_in.column(i, p);
+
+        const Number m_ij = direct.mass_matrix().get_entry(i, p);
+        scale = std::max(scale, std::abs(m_ij));
+        mass_deviation = std::max(
+            mass_deviation,
+            std::abs(m_ij - read_in.mass_matrix().get_entry(i, p)));
+
+        const auto c_ij = direct.cij_matrix().get_tensor(i, p);
+        const auto c_ij_read_in = read_in.cij_matrix().get_tensor(i, p);
+        cij_deviation = std::max(cij_deviation, (c_ij - c_ij_read_in).norm());
+
+        if (discretization.have_discontinuous_ansatz()) {
+          const Number b_ij = direct.mass_matrix_inverse().get_entry(i, p);
+          inverse_deviation = std::max(
+              inverse_deviation,
+              std::abs(b_ij - read_in.mass_matrix_inverse().get_entry(i, p)) /
+                  std::max(std::abs(b_ij), Number(1.)));
+        }
+      }
+
+      const Number m_i = direct.lumped_mass_matrix().local_element(i);
+      lumped_deviation = std::max(
+          lumped_deviation,
+          std::abs(m_i - read_in.lumped_mass_matrix().local_element(i)) /
+              m_i);
+    }
+
+    const auto all = [&](const bool value) {
+      return Utilities::MPI::min(static_cast<unsigned int>(value),
+                                 mpi_communicator) == 1;
+    };
+
+    const auto relative = [&](const double deviation) {
+      return all(deviation <= tolerance * scale);
+    };
+
+    const bool result_pattern = all(same_pattern);
+    const bool result_mass = relative(mass_deviation);
+    const bool result_cij = relative(cij_deviation);
+    const bool result_inverse = all(inverse_deviation <= tolerance);
+    const bool result_lumped = all(lumped_deviation <= tolerance);
+    const bool result_measure =
+        std::abs(direct.measure_of_omega() - read_in.measure_of_omega()) <=
+        tolerance * direct.measure_of_omega();
+
+    if (mpi_rank == 0) {
+      const auto report = [](const std::string &name, const bool result) {
+        std::cout << "  " << name << (result ? "yes" : "no") << std::endl;
+      };
+
+      std::cout << ansatz << ":" << std::endl;
+      report("identical sparsity pattern:   ", result_pattern);
+      report("mass matrix matches:          ", result_mass);
+      report("lumped mass matrix matches:   ", result_lumped);
+      report("c_ij matrix matches:          ", result_cij);
+      report("inverse mass matrix matches:  ", result_inverse);
+      report("measure of omega matches:     ", result_measure);
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,186 @@
+#include <sparse_matrix_simd.h>
+#include <sparse_matrix_simd.template.h>
+
+#include <deal.II/base/mpi.h>
+
+#include <chrono>
+#include <iostream>
+
+/*
+ * Compare the two storage variants for the transposed access of a scalar
+ * SparseMatrixSIMD on the access pattern of the l_ij bounds in the
+ * HyperbolicModule: every entry is written once (vectorized in the SIMD
+ * row range) and afterwards symmetrized via
+ * min(get_entry(), get_transposed_entry()):
+ *
+ *  - gather: get_transposed_entry() gathers through the transposed indices
+ *  - mirrored: write_entry() additionally scatters into a transposed
+ *    shadow copy that get_transposed_entry() loads contiguously
+ *
+ * Define BENCHMARK to additionally report the time per entry for writing
+ * and symmetrizing with both variants.
+ */
+
+// #define BENCHMARK
+
+using namespace ryujin;
+
+using VA = dealii::VectorizedArray<double>;
+constexpr auto simd_width = VA::size();
+
+constexpr unsigned int n_rows = 4101;
+constexpr unsigned int n_internal = (4096 / simd_width) * simd_width;
+
+using Matrix = SparseMatrixSIMD<double, 1, simd_width>;
+
+
+/* Copy all entries of @p source into @p matrix: */
+void write(Matrix &matrix,
+           const Matrix &source,
+           const SparsityPatternSIMD<simd_width> &sparsity)
+{
+  unsigned int i = 0;
+  for (; i < n_internal; i += simd_width)
+    for (unsigned int p = 0; p < sparsity.row_length(i); ++p)
+      matrix.write_entry(source.get_entry<VA>(i, p), i, p);
+  for (; i < n_rows; ++i)
+    for (unsigned int p = 0; p < sparsity.row_length(i); ++p)
+      matrix.write_entry(source.get_entry(i, p), i, p);
+}
+
+
+/* Symmetrize all entries of @p matrix and store them in @p result: */
+void symmetrize(std::vector<double> &result,
+                const Matrix &matrix,
+                const SparsityPatternSIMD<simd_width> &sparsity)
+{
+  std::size_t n = 0;
+  unsigned int i = 0;
+  for (; i < n_internal; i += simd_width)
+    for (unsigned int p = 0; p < sparsity.row_length(i); ++p) {
+      const auto l_ij = std::min(matrix.get_entry<VA>(i, p),
+                                 matrix.get_transposed_entry<VA>(i, p));
+      l_ij.store(result.data() + n);
+      n += simd_width;
+    }
+  for (; i < n_rows; ++i)
+    for (unsigned int p = 0; p < sparsity.row_length(i); ++p)
+      result[n++] = std::min(matrix.get_entry(i, p),
+                             matrix.get_transposed_entry(i, p));
+}
+
+
+#ifdef BENCHMARK
+void benchmark(const std::string &name,
+               Matrix &matrix,
+               const Matrix &source,
+               const SparsityPatternSIMD<simd_width> &sparsity,
+               std::vector<double> &result)
+{
+  constexpr unsigned int n_repetitions = 1000;
+
+  const auto start = std::chrono::steady_clock::now();
+  for (unsigned int r = 0; r < n_repetitions; ++r)
+    write(matrix, source, sparsity);
+  const auto middle = std::chrono::steady_clock::now();
+
+  double sum = 0.;
+  for (unsigned int r = 0; r < n_repetitions; ++r) {
+    symmetrize(result, matrix, sparsity);
+    sum += result[r % result.size()];
+  }
+  const auto stop = std::chrono::steady_clock::now();
+
+  const double n_entries = double(n_repetitions) * result.size();
+  const auto nanoseconds = [&](const auto &a, const auto &b) {
+    return std::chrono::duration<double, std::nano>(b - a).count() /
+           n_entries;
+  };
+
+  std::cout << "time per entry (" << name
+            << "): write " << nanoseconds(start, middle) << " ns, symmetrize "
+            << nanoseconds(middle, stop) << " ns (checksum " << sum << ")"
+            << std::endl;
+}
+#endif
+
+
+int main(int argc, char *argv[])
+{
+  dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv);
+
+  /*
+   * A periodic 1D stencil with a wide coupling, so that all rows have the
+   * same length and the transposed entries of a SIMD row are scattered
+   * over distant memory locations:
+   */
+  dealii::DynamicSparsityPattern dsp(n_rows, n_rows);
+  for (unsigned int i = 0; i < n_rows; ++i)
+    for (const unsigned int offset :
+         {n_rows - 64, n_rows - 3, n_rows - 1, 0u, 1u, 3u, 64u})
+      dsp.add(i, (i + offset) % n_rows);
+  dsp.compress();
+
+  dealii::IndexSet locally_owned(n_rows);
+  locally_owned.add_range(0, n_rows);
+  dealii::IndexSet locally_relevant(n_rows);
+  auto partitioner = std::make_shared<dealii::Utilities::MPI::Partitioner>(
+      locally_owned, locally_relevant, MPI_COMM_SELF);
+
+  SparsityPatternSIMD<simd_width> sparsity(n_internal, dsp, partitioner);
+
+  /* Nonsymmetric deterministic entries: */
+  Matrix source(sparsity);
+  for (unsigned int i = 0; i < n_rows; ++i)
+    for (unsigned int p = 0; p < sparsity.row_length(i); ++p) {
+      const unsigned int j = sparsity.column(i, p);
+      source.write_entry(1. + 0.01 * ((7 * i + 13 * j) % 101), i, p);
+    }
+
+  Matrix gather_matrix(sparsity);
+  Matrix mirrored_matrix;
+  mirrored_matrix.reinit(sparsity, /*mirror_transposed*/ true);
+
+  write(gather_matrix, source, sparsity);
+  write(mirrored_matrix, source, sparsity);
+
+  std::size_t n_entries = 0;
+  for (unsigned int i = 0; i < n_rows; ++i)
+    n_entries += sparsity.row_length(i);
+
+  std::vector<double> gather_result(n_entries);
+  std::vector<double> mirrored_result(n_entries);
+  symmetrize(gather_result, gather_matrix, sparsity);
+  symmetrize(mirrored_result, mirrored_matrix, sparsity);
+
+  /* Reference computed with scalar access on the source matrix: */
+  std::vector<double> reference;
+  bool transposed_match = true;
+  for (unsigned int i = 0; i < n_rows; i += (i < n_internal ? simd_width : 1))
+    for (unsigned int p = 0; p < sparsity.row_length(i); ++p) {
+      const unsigned int width = i < n_internal ? simd_width : 1;
+      for (unsigned int k = 0; k < width; ++k) {
+        const unsigned int j = sparsity.column(i + k, p);
+        const double l_ij = source.get_entry(i + k, p);
+        const double l_ji = 1. + 0.01 * ((7 * j + 13 * (i + k)) % 101);
+        transposed_match &= (source.get_transposed_entry(i + k, p) == l_ji);
+        reference.push_back(std::min(l_ij, l_ji));
+      }
+    }
+
+  const auto report = [](const std::string &name, const bool result) {
+    std::cout << name << (result ? "yes" : "no") << std::endl;
+  };
+
+  report("transposed entries match:            ", transposed_match);
+  report("gather l_ij match reference:         ", gather_result == reference);
+  report("mirrored l_ij match gather l_ij:     ",
+         mirrored_result == gather_result);
+
+#ifdef BENCHMARK
+  benchmark("gather", gather_matrix, source, sparsity, gather_result);
+  benchmark("mirrored", mirrored_matrix, source, sparsity, mirrored_result);
+#endif
+
+  return 0;
+}
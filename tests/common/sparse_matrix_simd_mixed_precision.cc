@@ -0,0 +1,104 @@
+#include <sparse_matrix_simd.h>
+#include <sparse_matrix_simd.template.h>
+
+/*
+ * Check converting accessors of a SparseMatrixSIMD with float storage
+ * that is accessed with double (and vectorized double) types. The output
+ * is independent of the SIMD width.
+ */
+
+int main()
+{
+  using VA = dealii::VectorizedArray<double>;
+  constexpr auto simd_width = VA::size();
+
+  dealii::DynamicSparsityPattern spars(14, 14);
+  spars.add(0, 0);
+  spars.add(0, 1);
+  spars.add(0, 13);
+  for (unsigned int i = 1; i < 12; ++i) {
+    spars.add(i, i - 1);
+    spars.add(i, i);
+    spars.add(i, i + 1);
+  }
+  spars.add(12, 12);
+  spars.add(12, 11);
+  spars.add(13, 13);
+  spars.add(13, 0);
+  spars.compress();
+
+  dealii::IndexSet locally_owned(14);
+  locally_owned.add_range(0, 14);
+  dealii::IndexSet locally_relevant(14);
+  auto partitioner = std::make_shared<dealii::Utilities::MPI::Partitioner>(
+      locally_owned, locally_relevant, MPI_COMM_SELF);
+
+  const unsigned int n_internal = (12 / simd_width) * simd_width;
+
+  ryujin::SparsityPatternSIMD<simd_width> my_sparsity(
+      n_internal, spars, partitioner);
+  ryujin::SparseMatrixSIMD<float, 1, simd_width> my_sparse(my_sparsity);
+  ryujin::SparseMatrixSIMD<float, 2, simd_width> my_sparse_2(my_sparsity);
+
+  /* Write with vectorized double access in the SIMD region: */
+  unsigned int i = 0;
+  for (; i < n_internal; i += simd_width)
+    for (unsigned int j = 0; j < 3; ++j) {
+      VA entry;
+      dealii::Tensor<1, 2, VA> tensor;
+      for (unsigned int k = 0; k < simd_width; ++k) {
+        entry[k] = double((i + k) * 3 + j) + 0.5;
+        tensor[0][k] = entry[k];
+        tensor[1][k] = -entry[k];
+      }
+      my_sparse.write_entry(entry, i, j);
+      my_sparse_2.write_entry(tensor, i, j);
+    }
+
+  /* Write with scalar double access in the remaining region: */
+  for (; i < 12; ++i)
+    for (unsigned int j = 0; j < 3; ++j) {
+      const double entry = double(i * 3 + j) + 0.5;
+      dealii::Tensor<1, 2, double> tensor;
+      tensor[0] = entry;
+      tensor[1] = -entry;
+      my_sparse.write_entry(entry, i, j);
+      my_sparse_2.write_entry(tensor, i, j);
+    }
+  my_sparse.write_entry(36.5, 12, 0);
+  my_sparse.write_entry(37.5, 12, 1);
+  my_sparse.write_entry(38.5, 13, 0);
+  my_sparse.write_entry(39.5, 13, 1);
+
+  std::cout << "Matrix entries row by row" << std::endl;
+  for (unsigned int i = 0; i < my_sparsity.n_rows(); ++i) {
+    for (unsigned int j = 0; j < my_sparsity.row_length(i); ++j) {
+      const double a = my_sparse.get_entry<double>(i, j);
+      std::cout << a << " ";
+    }
+    std::cout << std::endl;
+  }
+
+  /* Only print the first 8 rows that are vectorized for all SIMD widths: */
+
+  std::cout << "Matrix entries by SIMD rows" << std::endl;
+  for (unsigned int i = 0; i < 8; i += simd_width)
+    for (unsigned int k = 0; k < simd_width; ++k) {
+      for (unsigned int j = 0; j < 3; ++j) {
+        const auto a = my_sparse.get_entry<VA>(i, j);
+        const auto t = my_sparse_2.get_tensor<VA>(i, j);
+        std::cout << a[k] << " (" << t[0][k] << ", " << t[1][k] << ") ";
+      }
+      std::cout << std::endl;
+    }
+
+  std::cout << "Matrix entries transposed by SIMD rows" << std::endl;
+  for (unsigned int i = 0; i < 8; i += simd_width)
+    for (unsigned int k = 0; k < simd_width; ++k) {
+      for (unsigned int j = 0; j < 3; ++j) {
+        const auto a = my_sparse.get_transposed_entry<VA>(i, j);
+        std::cout << a[k] << " ";
+      }
+      std::cout << std::endl;
+    }
+}
@@ -0,0 +1,235 @@
+#include <sparse_matrix_simd.h>
+#include <sparse_matrix_simd.template.h>
+
+#include <deal.II/base/mpi.h>
+
+#include <iostream>
+
+/*
+ * Fill all storage variants of the SIMD sparse matrices from the same data
+ * and compare them against a plain SparseMatrixSIMD:
+ *
+ *  - column indices (compressed if COMPRESSED_COLUMN_INDICES is set)
+ *  - transpose-mirrored storage
+ *  - AntisymmetricSparseMatrixSIMD
+ *  - StencilSparseMatrixSIMD
+ *
+ * All accessors are checked with scalar access for all rows and with
+ * vectorized access for the SIMD row range [0, n_internal).
+ */
+
+using namespace ryujin;
+
+constexpr unsigned int n_rows = 40;
+constexpr unsigned int n_antisymmetric = 36;
+
+/*
+ * Matrix entries depend only on the offset j - i, so that all rows away
+ * from the periodic wrap share a stencil, and are antisymmetric except for
+ * the diagonal and couplings among the last rows.
+ */
+double value(const unsigned int i, const unsigned int j, const unsigned int d)
+{
+  if (i == j)
+    return 10. * (d + 1);
+
+  double result = (double(j) - double(i)) * (d + 1);
+  if (i >= n_antisymmetric && j >= n_antisymmetric)
+    result += 0.25;
+  return result;
+}
+
+
+int main(int argc, char *argv[])
+{
+  dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv);
+
+  using VA = dealii::VectorizedArray<double>;
+  constexpr auto simd_width = VA::size();
+  constexpr unsigned int n_internal =
+      (n_antisymmetric / simd_width) * simd_width;
+
+  /*
+   * Periodic couplings, so that all rows have the same length as required
+   * for the SIMD row range:
+   */
+  dealii::DynamicSparsityPattern dsp(n_rows, n_rows);
+  for (unsigned int i = 0; i < n_rows; ++i)
+    for (const unsigned int offset : {n_rows - 3, n_rows - 1, 0u, 1u, 3u})
+      dsp.add(i, (i + offset) % n_rows);
+  dsp.compress();
+
+  dealii::IndexSet locally_owned(n_rows);
+  locally_owned.add_range(0, n_rows);
+  dealii::IndexSet locally_relevant(n_rows);
+  auto partitioner = std::make_shared<dealii::Utilities::MPI::Partitioner>(
+      locally_owned, locally_relevant, MPI_COMM_SELF);
+
+  SparsityPatternSIMD<simd_width> sparsity(n_internal, dsp, partitioner);
+
+  SparseMatrixSIMD<double, 2, simd_width> matrix(sparsity);
+  SparseMatrixSIMD<double, 1, simd_width> scalar_matrix(sparsity);
+  SparseMatrixSIMD<double, 1, simd_width> mirrored_matrix;
+  mirrored_matrix.reinit(sparsity, /*mirror_transposed*/ true);
+
+  /* Sources for the stencil matrices, which take ownership: */
+  SparseMatrixSIMD<double, 2, simd_width> stencil_source(sparsity);
+  SparseMatrixSIMD<double, 1, simd_width> scalar_stencil_source(sparsity);
+
+  /* All rows distinct, thus stencil storage does not pay off: */
+  SparseMatrixSIMD<double, 1, simd_width> distinct_source(sparsity);
+  SparseMatrixSIMD<double, 1, simd_width> distinct_matrix(sparsity);
+
+  bool columns_match = true;
+
+  for (unsigned int i = 0; i < n_rows; ++i) {
+    const unsigned int stride = sparsity.stride_of_row(i);
+    const unsigned int *js = sparsity.columns(i);
+    columns_match &= (sparsity.row_length(i) == dsp.row_length(i));
+
+    for (unsigned int p = 0; p < sparsity.row_length(i); ++p) {
+      const unsigned int j = sparsity.column(i, p);
+      columns_match &= (js[p * stride] == j) && dsp.exists(i, j);
+
+      dealii::Tensor<1, 2, double> entry;
+      entry[0] = value(i, j, 0);
+      entry[1] = value(i, j, 1);
+      matrix.write_entry(entry, i, p);
+      scalar_matrix.write_entry(entry[0], i, p);
+      mirrored_matrix.write_entry(entry[0], i, p);
+      stencil_source.write_entry(entry, i, p);
+      scalar_stencil_source.write_entry(entry[0], i, p);
+      distinct_source.write_entry(entry[0] + i, i, p);
+      distinct_matrix.write_entry(entry[0] + i, i, p);
+    }
+  }
+
+  AntisymmetricSparseMatrixSIMD<double, 2, simd_width> antisymmetric_matrix;
+  antisymmetric_matrix.reinit(matrix);
+
+  StencilSparseMatrixSIMD<double, 2, simd_width> stencil_matrix;
+  stencil_matrix.reinit(std::move(stencil_source));
+
+  StencilSparseMatrixSIMD<double, 1, simd_width> scalar_stencil_matrix;
+  scalar_stencil_matrix.reinit(std::move(scalar_stencil_source));
+
+  StencilSparseMatrixSIMD<double, 1, simd_width> fallback_matrix;
+  fallback_matrix.reinit(std::move(distinct_source));
+
+  /* Scalar access for all rows: */
+
+  double plain_deviation = 0.;
+  double mirrored_deviation = 0.;
+  double antisymmetric_deviation = 0.;
+  double stencil_deviation = 0.;
+  double fallback_deviation = 0.;
+
+  for (unsigned int i = 0; i < n_rows; ++i) {
+    for (unsigned int p = 0; p < sparsity.row_length(i); ++p) {
+      const unsigned int j = sparsity.column(i, p);
+
+      const auto entry = matrix.get_tensor(i, p);
+      const auto transposed = matrix.get_transposed_tensor(i, p);
+      const auto scalar_transposed = scalar_matrix.get_transposed_entry(i, p);
+
+      for (unsigned int d = 0; d < 2; ++d) {
+        plain_deviation = std::max(
+            {plain_deviation,
+             std::abs(entry[d] - value(i, j, d)),
+             std::abs(transposed[d] - value(j, i, d))});
+      }
+      plain_deviation = std::max(
+          {plain_deviation,
+           std::abs(scalar_matrix.get_entry(i, p) - entry[0]),
+           std::abs(scalar_transposed - transposed[0])});
+
+      mirrored_deviation = std::max(
+          {mirrored_deviation,
+           std::abs(mirrored_matrix.get_entry(i, p) - entry[0]),
+           std::abs(mirrored_matrix.get_transposed_entry(i, p) -
+                    scalar_transposed)});
+
+      antisymmetric_deviation = std::max(
+          {antisymmetric_deviation,
+           (antisymmetric_matrix.get_tensor(i, p) - entry).norm(),
+           (antisymmetric_matrix.get_transposed_tensor(i, p) - transposed)
+               .norm()});
+
+      stencil_deviation = std::max(
+          {stencil_deviation,
+           (stencil_matrix.get_tensor(i, p) - entry).norm(),
+           (stencil_matrix.get_transposed_tensor(i, p) - transposed).norm(),
+           std::abs(scalar_stencil_matrix.get_entry(i, p) - entry[0]),
+           std::abs(scalar_stencil_matrix.get_transposed_entry(i, p) -
+                    scalar_transposed)});
+
+      fallback_deviation = std::max(
+          {fallback_deviation,
+           std::abs(fallback_matrix.get_entry(i, p) -
+                    distinct_matrix.get_entry(i, p)),
+           std::abs(fallback_matrix.get_transposed_entry(i, p) -
+                    distinct_matrix.get_transposed_entry(i, p))});
+    }
+  }
+
+  /* Vectorized access for the SIMD row range: */
+
+  double simd_deviation = 0.;
+
+  for (unsigned int i = 0; i < n_internal; i += simd_width) {
+    for (unsigned int p = 0; p < sparsity.row_length(i); ++p) {
+      const auto entry = matrix.get_tensor<VA>(i, p);
+      const auto scalar_transposed =
+          scalar_matrix.get_transposed_entry<VA>(i, p);
+
+      const auto mirrored = mirrored_matrix.get_entry<VA>(i, p);
+      const auto mirrored_transposed =
+          mirrored_matrix.get_transposed_entry<VA>(i, p);
+      const auto antisymmetric = antisymmetric_matrix.get_tensor<VA>(i, p);
+      const auto stencil = stencil_matrix.get_tensor<VA>(i, p);
+      const auto scalar_stencil = scalar_stencil_matrix.get_entry<VA>(i, p);
+      const auto fallback = fallback_matrix.get_entry<VA>(i, p);
+      const auto distinct = distinct_matrix.get_entry<VA>(i, p);
+
+      for (unsigned int k = 0; k < simd_width; ++k) {
+        const unsigned int j = sparsity.column(i + k, p);
+        for (unsigned int d = 0; d < 2; ++d) {
+          simd_deviation = std::max(
+              {simd_deviation,
+               std::abs(entry[d][k] - value(i + k, j, d)),
+               std::abs(antisymmetric[d][k] - entry[d][k]),
+               std::abs(stencil[d][k] - entry[d][k])});
+        }
+        simd_deviation = std::max(
+            {simd_deviation,
+             std::abs(scalar_transposed[k] - value(j, i + k, 0)),
+             std::abs(mirrored[k] - entry[0][k]),
+             std::abs(mirrored_transposed[k] - scalar_transposed[k]),
+             std::abs(scalar_stencil[k] - entry[0][k]),
+             std::abs(fallback[k] - distinct[k])});
+      }
+    }
+  }
+
+  const auto report = [](const std::string &name, const bool result) {
+    std::cout << name << (result ? "yes" : "no") << std::endl;
+  };
+
+  report("column indices match pattern:        ", columns_match);
+  report("antisymmetric storage omits entries: ",
+         antisymmetric_matrix.n_stored_elements() <
+             sparsity.n_nonzero_elements());
+  report("stencil storage compresses rows:     ",
+         stencil_matrix.compressed() && scalar_stencil_matrix.compressed() &&
+             stencil_matrix.n_stencils() < n_rows);
+  report("distinct rows fall back to matrix:   ",
+         !fallback_matrix.compressed() && fallback_deviation == 0.);
+  report("plain matrix matches data:           ", plain_deviation == 0.);
+  report("transposed storage matches:          ", mirrored_deviation == 0.);
+  report("antisymmetric storage matches:       ",
+         antisymmetric_deviation == 0.);
+  report("stencil storage matches:             ", stencil_deviation == 0.);
+  report("vectorized access matches:           ", simd_deviation == 0.);
+
+  return 0;
+}
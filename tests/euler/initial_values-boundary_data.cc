@@ -0,0 +1,119 @@
+#include <description.h>
+#include <discretization.h>
+#include <initial_values.h>
+#include <offline_data.h>
+
+#include <deal.II/base/mpi.h>
+
+#include <iostream>
+#include <sstream>
+
+/*
+ * Check how Dirichlet boundary data treats the random perturbation of the
+ * initial state: With "perturbation" set to a positive value, cached
+ * boundary data (time independent or tabulated) must be identical to the
+ * unperturbed initial state. Boundary data evaluated for every stage
+ * keeps the perturbation at t = 0 and is unperturbed for t > 0.
+ */
+
+using namespace ryujin::Euler;
+using namespace ryujin;
+using namespace dealii;
+
+constexpr int dim = 2;
+using Number = double;
+using View = HyperbolicSystemView<dim, Number>;
+
+int main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  const MPI_Comm mpi_communicator(MPI_COMM_WORLD);
+
+  HyperbolicSystem hyperbolic_system("/B - Equation");
+  Discretization<dim> discretization(mpi_communicator, "/C - Discretization");
+  OfflineData<dim, Number> offline_data(
+      mpi_communicator, discretization, "/D - OfflineData");
+  InitialValues<Description, dim, Number> initial_values(
+      hyperbolic_system, offline_data, "/E - InitialValues");
+  InitialValues<Description, dim, Number> reference(
+      hyperbolic_system, offline_data, "/Reference");
+
+  const auto initialize = [&](const bool time_independent,
+                              const Number tabulation_interval) {
+    std::stringstream parameters;
+    parameters << "subsection C - Discretization\n"
+               << "set geometry = rectangular domain\n"
+               << "set mesh refinement = 3\n"
+               << "end\n"
+               << "subsection E - InitialValues\n"
+               << "set configuration = uniform\n"
+               << "set perturbation = 0.1\n"
+               << "set boundary data time independent = "
+               << (time_independent ? "true" : "false") << "\n"
+               << "set boundary data tabulation interval = "
+               << tabulation_interval << "\n"
+               << "end\n"
+               << "subsection Reference\n"
+               << "set configuration = uniform\n"
+               << "end" << std::endl;
+    ParameterAcceptor::initialize(parameters);
+  };
+
+  const auto check = [&](const std::string &name) {
+    discretization.prepare("test");
+    offline_data.prepare(View::problem_dimension, View::n_precomputed_values);
+    initial_values.prepare();
+
+    const auto &boundary_map_soa = offline_data.boundary_map_soa();
+
+    /* Return whether all Dirichlet data at time t is unperturbed: */
+    const auto unperturbed = [&](const Number t) {
+      initial_values.update_boundary_data(t);
+      bool result = true;
+      for (unsigned int k = 0; k < boundary_map_soa.i.size(); ++k) {
+        if (boundary_map_soa.id[k] != Boundary::dirichlet)
+          continue;
+        const auto &position = boundary_map_soa.position[k];
+        const auto U_ref = reference.initial_state(position, t);
+        result &= (initial_values.boundary_state(k) == U_ref);
+      }
+      return result;
+    };
+
+    unsigned int n_dirichlet = 0;
+    bool perturbed = false;
+    for (unsigned int k = 0; k < boundary_map_soa.i.size(); ++k) {
+      if (boundary_map_soa.id[k] != Boundary::dirichlet)
+        continue;
+      ++n_dirichlet;
+
+      const auto &position = boundary_map_soa.position[k];
+      const auto U_ref = reference.initial_state(position, Number(0.));
+      const auto U_i = initial_values.initial_state(position, Number(0.));
+      perturbed |= (U_i != U_ref);
+    }
+
+    const auto yes_no = [](const bool value) { return value ? "yes" : "no"; };
+
+    std::cout << name << ":" << std::endl;
+    std::cout << "  Dirichlet entries found:           "
+              << yes_no(n_dirichlet > 0) << std::endl;
+    std::cout << "  initial state perturbed:           " << yes_no(perturbed)
+              << std::endl;
+    std::cout << "  boundary data unperturbed (t = 0): "
+              << yes_no(unperturbed(Number(0.))) << std::endl;
+    std::cout << "  boundary data unperturbed (t > 0): "
+              << yes_no(unperturbed(Number(0.5))) << std::endl;
+  };
+
+  initialize(true, Number(0.));
+  check("time independent boundary data");
+
+  initialize(false, Number(0.25));
+  check("tabulated boundary data");
+
+  initialize(false, Number(0.));
+  check("per-stage boundary data");
+
+  return 0;
+}
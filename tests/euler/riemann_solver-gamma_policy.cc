@@ -0,0 +1,183 @@
+// force distinct symbols in test
+#define Euler EulerTest
+
+#include <hyperbolic_system.h>
+#include <multicomponent_vector.h>
+#include <riemann_solver.h>
+#include <riemann_solver.template.h>
+#include <simd.h>
+
+#include <chrono>
+
+/*
+ * Compare the wave speed estimate computed with the specialized power
+ * kernels for gamma = 7/5 and gamma = 5/3 against the generic code path.
+ * Also check that the dispatch actually selects the specialized policy.
+ *
+ * Define BENCHMARK to additionally report the time per edge for both
+ * variants.
+ */
+
+// #define BENCHMARK
+
+using namespace ryujin::Euler;
+using namespace ryujin;
+using namespace dealii;
+
+constexpr int dim = 1;
+constexpr unsigned int n_edges = 4096;
+constexpr unsigned int n_printed_edges = 4;
+
+/* A deterministic set of primitive states (rho, u, p): */
+std::vector<std::array<double, 3>> create_states()
+{
+  std::vector<std::array<double, 3>> states(n_edges + 1);
+  unsigned int seed = 42;
+  const auto random = [&seed]() {
+    seed = 1103515245u * seed + 12345u;
+    return double((seed >> 8) & 0xffffu) / 65535.;
+  };
+  for (auto &state : states) {
+    state[0] = std::pow(10., 2. * random() - 1.);
+    state[1] = 10. * random() - 5.;
+    state[2] = std::pow(10., 4. * random() - 2.);
+  }
+  return states;
+}
+
+
+template <typename Number>
+std::vector<double>
+compute_lambda(const HyperbolicSystem &hyperbolic_system,
+               const std::vector<std::array<double, 3>> &states)
+{
+  const unsigned int width = get_stride_size<Number>;
+
+  const auto view = hyperbolic_system.view<dim, Number>();
+  const auto gamma = view.gamma();
+
+  typename HyperbolicSystemView<dim, Number>::PrecomputedVector dummy;
+
+  typename RiemannSolver<dim, Number>::Parameters riemann_solver_parameters;
+  RiemannSolver<dim, Number> riemann_solver(
+      hyperbolic_system, riemann_solver_parameters, dummy);
+
+  const auto riemann_data = [&](const unsigned int i) {
+    std::array<Number, 4> result;
+    for (unsigned int k = 0; k < width; ++k) {
+      const auto &state = states[(i + k) % states.size()];
+      if constexpr (std::is_same_v<Number, double>) {
+        result[0] = state[0];
+        result[1] = state[1];
+        result[2] = state[2];
+      } else {
+        result[0][k] = state[0];
+        result[1][k] = state[1];
+        result[2][k] = state[2];
+      }
+    }
+    result[3] = std::sqrt(gamma * result[2] / result[0]);
+    return result;
+  };
+
+  std::vector<double> lambda(n_edges);
+  for (unsigned int i = 0; i < n_edges; i += width) {
+    const auto lambda_max =
+        riemann_solver.compute(riemann_data(i), riemann_data(i + 1));
+    for (unsigned int k = 0; k < width; ++k) {
+      if constexpr (std::is_same_v<Number, double>)
+        lambda[i + k] = lambda_max;
+      else
+        lambda[i + k] = lambda_max[k];
+    }
+  }
+
+#ifdef BENCHMARK
+  constexpr unsigned int n_repetitions = 1000;
+
+  std::vector<std::array<Number, 4>> data;
+  for (unsigned int i = 0; i <= n_edges; i += width)
+    data.push_back(riemann_data(i));
+
+  Number sum = Number(0.);
+  const auto start = std::chrono::steady_clock::now();
+  for (unsigned int r = 0; r < n_repetitions; ++r)
+    for (unsigned int i = 0; i + 1 < data.size(); ++i)
+      sum += riemann_solver.compute(data[i], data[i + 1]);
+  const auto stop = std::chrono::steady_clock::now();
+
+  const double nanoseconds =
+      std::chrono::duration<double, std::nano>(stop - start).count();
+  const bool is_generic =
+      view.gamma_policy() == HyperbolicSystem::GammaPolicy::generic;
+  std::cout << "    time per edge (" << (is_generic ? "generic" : "specialized")
+            << "): "
+            << nanoseconds / (n_repetitions * (data.size() - 1) * width)
+            << " ns (checksum " << sum << ")" << std::endl;
+#endif
+
+  return lambda;
+}
+
+
+template <typename Number>
+void test(const HyperbolicSystem &specialized,
+          const HyperbolicSystem &generic,
+          const std::vector<std::array<double, 3>> &states)
+{
+  const auto lambda_specialized =
+      compute_lambda<Number>(specialized, states);
+  const auto lambda_generic = compute_lambda<Number>(generic, states);
+
+  for (unsigned int i = 0; i < n_printed_edges; ++i)
+    std::cout << "    lambda_max[" << i << "]: " << lambda_specialized[i]
+              << " " << lambda_generic[i] << std::endl;
+}
+
+
+int main()
+{
+  HyperbolicSystem specialized("/Specialized");
+  HyperbolicSystem generic("/Generic");
+
+  const auto states = create_states();
+
+  std::cout << std::setprecision(10);
+  std::cout << std::scientific;
+
+  using GammaPolicy = HyperbolicSystem::GammaPolicy;
+  const std::array<std::pair<std::string, GammaPolicy>, 2> policies{
+      {{"1.4", GammaPolicy::diatomic},
+       {"1.6666666666666667", GammaPolicy::monatomic}}};
+
+  for (const auto &[gamma, policy] : policies) {
+    std::stringstream parameters;
+    parameters << "subsection Specialized\n"
+               << "set gamma = " << gamma << "\n"
+               << "end\n"
+               << "subsection Generic\n"
+               << "set gamma = " << gamma << "\n"
+               << "set gamma specialization = false\n"
+               << "end" << std::endl;
+    ParameterAcceptor::initialize(parameters);
+
+    std::cout << "gamma = " << gamma << std::endl;
+    std::cout << "  specialized policy selected: "
+              << (specialized.view<dim, double>().gamma_policy() == policy
+                      ? "yes"
+                      : "no")
+              << std::endl;
+    std::cout << "  generic policy selected:     "
+              << (generic.view<dim, double>().gamma_policy() ==
+                          GammaPolicy::generic
+                      ? "yes"
+                      : "no")
+              << std::endl;
+    std::cout << "  double:" << std::endl;
+    test<double>(specialized, generic, states);
+    std::cout << "  VectorizedArray<double>:" << std::endl;
+    test<VectorizedArray<double>>(specialized, generic, states);
+  }
+
+  return 0;
+}
@@ -0,0 +1,120 @@
+#include <equation_of_state_jones_wilkins_lee.h>
+#include <equation_of_state_noble_abel_stiffened_gas.h>
+#include <equation_of_state_polytropic_gas.h>
+#include <equation_of_state_van_der_waals.h>
+
+#include <deal.II/base/vectorization.h>
+
+#include <iomanip>
+#include <iostream>
+
+/*
+ * Test the vectorized interface of the analytic EOS: Evaluate with
+ * VectorizedArray<double> and VectorizedArray<float> arguments. The
+ * output is independent of the SIMD width.
+ */
+
+using namespace ryujin::EquationOfStateLibrary;
+using namespace ryujin;
+using namespace dealii;
+
+template <typename EOS>
+void test(const EOS &eos, const double rho_scale, const double e_scale)
+{
+  std::cout << std::setprecision(10);
+  std::cout << std::scientific;
+  std::cout << "name = " << eos.name() << std::endl;
+
+  constexpr unsigned int n = 8;
+  std::array<double, n> rho{{1.4, 1.3, 1.2, 1.1, 1.0, 0.9, 0.8, 0.7}};
+  std::array<double, n> e{{0.3, 0.2, 0.1, 0.05, 0.025, 0.5, 1.0, 2.0}};
+  for (unsigned int i = 0; i < n; ++i) {
+    rho[i] *= rho_scale;
+    e[i] *= e_scale;
+  }
+
+  using VA = VectorizedArray<double>;
+  using VAF = VectorizedArray<float>;
+
+  std::cout << "VectorizedArray<double>:" << std::endl;
+  for (unsigned int i = 0; i < n; i += VA::size()) {
+    VA rho_v, e_v;
+    rho_v.load(rho.data() + i);
+    e_v.load(e.data() + i);
+    const VA p_v = eos.pressure(rho_v, e_v);
+    const VA e_back_v = eos.specific_internal_energy(rho_v, p_v);
+    const VA c_v = eos.speed_of_sound(rho_v, e_v);
+    const VA T_v = eos.temperature(rho_v, e_v);
+
+    for (unsigned int k = 0; k < VA::size(); ++k)
+      std::cout << "rho = " << rho[i + k] << "  e = " << e[i + k]
+                << "  p = " << p_v[k] << "  e_back = " << e_back_v[k]
+                << "  c = " << c_v[k] << "  T = " << T_v[k] << std::endl;
+  }
+
+  /*
+   * Single precision results are printed with fewer digits, the last
+   * digits depend on the pow/exp implementation:
+   */
+  std::cout << "VectorizedArray<float>:" << std::endl;
+  std::cout << std::setprecision(4);
+  for (unsigned int i = 0; i < n; i += VAF::size()) {
+    VAF rho_v, e_v;
+    for (unsigned int k = 0; k < VAF::size(); ++k) {
+      rho_v[k] = rho[i + k];
+      e_v[k] = e[i + k];
+    }
+    const VAF p_v = eos.pressure(rho_v, e_v);
+    const VAF c_v = eos.speed_of_sound(rho_v, e_v);
+
+    for (unsigned int k = 0; k < VAF::size(); ++k)
+      std::cout << "rho = " << rho_v[k] << "  e = " << e_v[k]
+                << "  p = " << p_v[k] << "  c = " << c_v[k] << std::endl;
+  }
+}
+
+int main()
+{
+  std::cout << "\nPolytropicGas with gamma=1.4" << std::endl;
+  PolytropicGas polytropic_gas("");
+  test(polytropic_gas, 1., 1.);
+
+  std::cout
+      << "\nNobleAbelStiffenedGas with gamma=1.4, b=0.2, q=0.00125, pinf=0.005"
+      << std::endl;
+  NobleAbelStiffenedGas noble_abel_stiffened_gas("");
+  {
+    std::stringstream parameters;
+    parameters << "subsection noble abel stiffened gas\n"
+               << "set gamma = 1.4\n"
+               << "set covolume b = 0.2\n"
+               << "set reference specific internal energy = 0.00125\n"
+               << "set reference pressure = 0.005\n"
+               << "end\n"
+               << std::endl;
+    ParameterAcceptor::initialize(parameters);
+  }
+  test(noble_abel_stiffened_gas, 1., 1.);
+
+  std::cout << "\nVanDerWaals with gamma=1.4, a=0.015, b=0.2" << std::endl;
+  VanDerWaals van_der_waals("");
+  {
+    std::stringstream parameters;
+    parameters << "subsection van der waals\n"
+               << "set gamma = 1.40\n"
+               << "set covolume b = 0.2\n"
+               << "set vdw a = 0.015\n"
+               << "end\n"
+               << std::endl;
+    ParameterAcceptor::initialize(parameters);
+  }
+  test(van_der_waals, 1., 1.);
+
+  std::cout << "\nJonesWilkinsLee with omega=0.8938, A=6.3207e13, B=-4.472e9, "
+               "R1=11.3, R2=1.13, rho_0=1895, q_0=0"
+            << std::endl;
+  JonesWilkinsLee jones_wilkins_lee("");
+  test(jones_wilkins_lee, 2.e3, 1.e6);
+
+  return 0;
+}
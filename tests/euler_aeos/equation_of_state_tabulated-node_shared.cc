@@ -0,0 +1,86 @@
+#include <equation_of_state_tabulated.h>
+
+#include <deal.II/base/mpi.h>
+
+#include <iomanip>
+#include <iostream>
+
+/*
+ * Test the node-shared path of the tabulated EOS: Read a table file with
+ * "node shared tables" enabled (the default) on all MPI ranks and check
+ * that every rank interpolates the same values from cache-line aligned
+ * tables.
+ *
+ * The table samples p = 0.4 rho e on the log-spaced nodes 1e-2, 1e-1, 1,
+ * 1e1, 1e2. Evaluating at a node returns the sampled value, evaluating
+ * at the geometric mean of two neighboring nodes returns the bilinear
+ * average 0.4 * (x_0 + x_1) / 2 * (y_0 + y_1) / 2.
+ */
+
+using namespace ryujin::EquationOfStateLibrary;
+using namespace ryujin;
+using namespace dealii;
+
+int main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  const MPI_Comm mpi_communicator(MPI_COMM_WORLD);
+  const auto mpi_rank = Utilities::MPI::this_mpi_process(mpi_communicator);
+
+  constexpr unsigned int n = 5;
+
+  if (mpi_rank == 0) {
+    Tabulated tabulated("");
+    for (auto *table :
+         {&tabulated.p_rho_e(), &tabulated.e_rho_p(), &tabulated.c_rho_e()}) {
+      table->reinit(n, n, 1.e-2, 1.e2, 1.e-2, 1.e2);
+      for (unsigned int i = 0; i < n; ++i)
+        for (unsigned int j = 0; j < n; ++j)
+          (*table)(i, j) = 0.4 * table->x(i) * table->y(j);
+    }
+    tabulated.write("node_shared.eos");
+  }
+
+  int ierr = MPI_Barrier(mpi_communicator);
+  AssertThrowMPI(ierr);
+
+  Tabulated tabulated("", mpi_communicator);
+  tabulated.read("node_shared.eos");
+
+  const std::array<std::array<double, 2>, 4> points{{
+      {{1., 1.e-1}},
+      {{1.e-2, 1.e2}},
+      {{std::sqrt(1.e-1), std::sqrt(1.e1)}},
+      {{std::sqrt(1.e1 * 1.e2), std::sqrt(1.e-2 * 1.e-1)}},
+  }};
+
+  std::vector<double> values;
+  for (const auto &[rho, e] : points)
+    values.push_back(tabulated.pressure(rho, e));
+
+  const auto values_max = Utilities::MPI::max(values, mpi_communicator);
+  const auto values_min = Utilities::MPI::min(values, mpi_communicator);
+
+  bool aligned = true;
+  for (const auto *table :
+       {&tabulated.p_rho_e(), &tabulated.e_rho_p(), &tabulated.c_rho_e()}) {
+    const auto address = reinterpret_cast<std::uintptr_t>(table->data());
+    aligned &= (address % LogSpacedTable::alignment == 0);
+  }
+  aligned = Utilities::MPI::min(int(aligned), mpi_communicator) == 1;
+
+  if (mpi_rank == 0) {
+    std::cout << std::setprecision(10);
+    std::cout << std::scientific;
+    std::cout << "name = " << tabulated.name() << std::endl;
+    for (unsigned int k = 0; k < points.size(); ++k)
+      std::cout << "rho = " << points[k][0] << "  e = " << points[k][1]
+                << "  p = " << values[k] << std::endl;
+    std::cout << "identical on all ranks:  "
+              << (values_max == values_min ? "yes" : "no") << std::endl;
+    std::cout << "cache-line aligned:      " << (aligned ? "yes" : "no")
+              << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,164 @@
+#include <equation_of_state_polytropic_gas.h>
+#include <equation_of_state_tabulated.h>
+
+#include <deal.II/base/vectorization.h>
+
+#include <iomanip>
+#include <iostream>
+
+/*
+ * Test the tabulated EOS: Sample a polytropic gas on log-spaced tables,
+ * write the tables to disk and read them back in, and print the (scalar
+ * and vectorized) interpolated values next to the analytic expressions.
+ * The output is independent of the SIMD width.
+ */
+
+using namespace ryujin::EquationOfStateLibrary;
+using namespace ryujin;
+using namespace dealii;
+
+int main()
+{
+  PolytropicGas polytropic_gas("");
+
+  constexpr unsigned int n = 256;
+  constexpr double min = 1.e-2;
+  constexpr double max = 1.e2;
+
+  {
+    Tabulated tabulated("");
+    tabulated.p_rho_e().reinit(n, n, min, max, min, max);
+    tabulated.e_rho_p().reinit(n, n, min, max, min, max);
+    tabulated.c_rho_e().reinit(n, n, min, max, min, max);
+
+    for (unsigned int i = 0; i < n; ++i)
+      for (unsigned int j = 0; j < n; ++j) {
+        auto &table = tabulated.p_rho_e();
+        table(i, j) = polytropic_gas.pressure(table.x(i), table.y(j));
+      }
+
+    for (unsigned int i = 0; i < n; ++i)
+      for (unsigned int j = 0; j < n; ++j) {
+        auto &table = tabulated.e_rho_p();
+        table(i, j) =
+            polytropic_gas.specific_internal_energy(table.x(i), table.y(j));
+      }
+
+    for (unsigned int i = 0; i < n; ++i)
+      for (unsigned int j = 0; j < n; ++j) {
+        auto &table = tabulated.c_rho_e();
+        table(i, j) = polytropic_gas.speed_of_sound(table.x(i), table.y(j));
+      }
+
+    tabulated.write("polytropic_gas.eos");
+  }
+
+  Tabulated tabulated("");
+  tabulated.read("polytropic_gas.eos");
+
+  std::cout << "name = " << tabulated.name() << std::endl;
+
+  constexpr unsigned int n_samples = 8;
+  std::array<double, n_samples> rho{{1.4, 1.3, 1.2, 1.1, 1.0, 0.9, 0.8, 7.}};
+  std::array<double, n_samples> e{{0.3, 0.2, 0.1, 0.05, 0.025, 0.5, 1.0, 20.}};
+
+  using VA = VectorizedArray<double>;
+  using VAF = VectorizedArray<float>;
+
+  std::cout << std::setprecision(10);
+  std::cout << std::scientific;
+
+  std::cout << "scalar (tabulated, analytic):" << std::endl;
+  for (unsigned int i = 0; i < n_samples; ++i) {
+    const double p = tabulated.pressure(rho[i], e[i]);
+    std::cout << "rho = " << rho[i] << "  e = " << e[i] << "  p = " << p
+              << " " << polytropic_gas.pressure(rho[i], e[i])
+              << "  e_back = " << tabulated.specific_internal_energy(rho[i], p)
+              << "  c = " << tabulated.speed_of_sound(rho[i], e[i]) << " "
+              << polytropic_gas.speed_of_sound(rho[i], e[i]) << std::endl;
+  }
+
+  std::cout << "VectorizedArray<double>:" << std::endl;
+  for (unsigned int i = 0; i < n_samples; i += VA::size()) {
+    VA rho_v, e_v;
+    rho_v.load(rho.data() + i);
+    e_v.load(e.data() + i);
+    const VA p_v = tabulated.pressure(rho_v, e_v);
+    const VA e_back_v = tabulated.specific_internal_energy(rho_v, p_v);
+    const VA c_v = tabulated.speed_of_sound(rho_v, e_v);
+
+    for (unsigned int k = 0; k < VA::size(); ++k)
+      std::cout << "rho = " << rho[i + k] << "  e = " << e[i + k]
+                << "  p = " << p_v[k] << "  e_back = " << e_back_v[k]
+                << "  c = " << c_v[k] << std::endl;
+  }
+
+  /*
+   * Values outside of the table are clamped. This includes zero,
+   * negative, denormal, and huge arguments (which must not produce an out
+   * of bounds read):
+   */
+  std::array<double, n_samples> rho_out{
+      {1.e3, -1., 1.e-310, 1.e300, 0., -1., 1.e-310, 1.e300}};
+  std::array<double, n_samples> e_out{
+      {1.e-3, 1.e-310, -1., 0., 0., 1.e300, 1.e300, -1.}};
+
+  const auto clamp = [&](const double x) {
+    return std::min(std::max(x, min), max);
+  };
+
+  std::cout << "out of range (tabulated, analytic at boundary):"
+            << std::endl;
+  for (unsigned int i = 0; i < n_samples; ++i) {
+    std::cout << "rho = " << rho_out[i] << "  e = " << e_out[i]
+              << "  p = " << tabulated.pressure(rho_out[i], e_out[i]) << " "
+              << polytropic_gas.pressure(clamp(rho_out[i]), clamp(e_out[i]))
+              << std::endl;
+  }
+
+  std::cout << "out of range, VectorizedArray<double>:" << std::endl;
+  for (unsigned int i = 0; i < n_samples; i += VA::size()) {
+    VA rho_v, e_v;
+    rho_v.load(rho_out.data() + i);
+    e_v.load(e_out.data() + i);
+    const VA p_v = tabulated.pressure(rho_v, e_v);
+    for (unsigned int k = 0; k < VA::size(); ++k)
+      std::cout << "rho = " << rho_out[i + k] << "  e = " << e_out[i + k]
+                << "  p = " << p_v[k] << std::endl;
+  }
+
+  /*
+   * Single precision results are printed with fewer digits, the last
+   * digits depend on the log implementation:
+   */
+  std::cout << std::setprecision(4);
+
+  std::cout << "VectorizedArray<float>:" << std::endl;
+  for (unsigned int i = 0; i < n_samples; i += VAF::size()) {
+    VAF rho_v, e_v;
+    for (unsigned int k = 0; k < VAF::size(); ++k) {
+      rho_v[k] = rho[i + k];
+      e_v[k] = e[i + k];
+    }
+    const VAF p_v = tabulated.pressure(rho_v, e_v);
+    const VAF c_v = tabulated.speed_of_sound(rho_v, e_v);
+    for (unsigned int k = 0; k < VAF::size(); ++k)
+      std::cout << "rho = " << rho_v[k] << "  e = " << e_v[k]
+                << "  p = " << p_v[k] << "  c = " << c_v[k] << std::endl;
+  }
+
+  std::cout << "out of range, VectorizedArray<float>:" << std::endl;
+  for (unsigned int i = 0; i < n_samples; i += VAF::size()) {
+    VAF rho_v, e_v;
+    for (unsigned int k = 0; k < VAF::size(); ++k) {
+      rho_v[k] = rho_out[i + k];
+      e_v[k] = e_out[i + k];
+    }
+    const VAF p_v = tabulated.pressure(rho_v, e_v);
+    for (unsigned int k = 0; k < VAF::size(); ++k)
+      std::cout << "rho = " << rho_out[i + k] << "  e = " << e_out[i + k]
+                << "  p = " << p_v[k] << std::endl;
+  }
+
+  return 0;
+}